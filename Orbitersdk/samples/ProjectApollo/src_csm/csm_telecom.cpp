@@ -37,8 +37,12 @@
 #include "LEM.h"
 #include "ioChannels.h"
 #include "tracer.h"
+#include "NamedObjects.h"
 #include "Mission.h"
 
+// Bit rate of the fast MCC uplink
+#define MCC_UPLINK_BIT_RATE 2000.0
+
 // DS20060326 TELECOM OBJECTS
 
 // PREMODULATION PROCESSOR
@@ -969,8 +973,8 @@ void HGA::TimeStep(double simt, double simdt)
 	MATRIX3 Rot;
 	double relang, beamwidth, Moonrelang, EarthSignalDist;
 
-	OBJHANDLE hMoon = oapiGetObjectByName("Moon");
-	OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+	OBJHANDLE hMoon = NamedObjects::Moon();
+	OBJHANDLE hEarth = NamedObjects::Earth();
 
 	//Global position of Earth, Moon and spacecraft, spacecraft rotation matrix from local to global
 	sat->GetGlobalPos(pos);
@@ -1227,8 +1231,8 @@ void OMNI::Init(Saturn *vessel) {
 
 	hpbw_factor = acos(sqrt(sqrt(0.5))) / (beamwidth / 2.0); //Scaling for beamwidth
 
-	hMoon = oapiGetObjectByName("Moon");
-	hEarth = oapiGetObjectByName("Earth");
+	hMoon = NamedObjects::Moon();
+	hEarth = NamedObjects::Earth();
 
 	OMNIFrequency = 2119; //MHz. Should this get set somewhere else?
 	OMNIWavelength = C0 / (OMNIFrequency * 1000000); //meters
@@ -1583,6 +1587,7 @@ PCM::PCM(){
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0; 
 	mcc_size = 0; mcc_offset = 0;
+	mcc_fast = false; mcc_credit = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = 0;
@@ -1594,6 +1599,7 @@ void PCM::Init(Saturn *vessel){
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
 	mcc_size = 0; mcc_offset = 0;
+	mcc_fast = false; mcc_credit = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = MINUS_INFINITY;
@@ -4544,6 +4550,10 @@ void PCM::perform_io(double simt){
 		case 1: // INITALIZED, LISTENING
 			// Do we have data from MCC?
 			if (mcc_size > 0) {
+				if (mcc_fast) {
+					fast_mcc_uplink(simt);
+					break;
+				}
 				// sprintf(oapiDebugString(), "MCCSIZE %d LRX %f LRXINT %f", mcc_size, last_rx, ((simt - last_rx) / 0.005));
 				// Should we recieve?
 				if ((fabs(simt - last_rx) / 0.1) < 1 || sat->agc.IsUpruptActive()) {
@@ -4675,6 +4685,29 @@ void PCM::perform_io(double simt){
 	}
 }
 
+// Feed MCC data at the uplink bit rate. The byte completing a word causes an UPRUPT and the next
+// word waits until the AGC has taken it, so a load needs about one time step per keystroke.
+void PCM::fast_mcc_uplink(double simt) {
+	// No bursts after waiting for the AGC, at most one word (3 bytes) at once
+	mcc_credit += fabs(simt - last_rx) * MCC_UPLINK_BIT_RATE / 8.0;
+	if (mcc_credit > 3.0) { mcc_credit = 3.0; }
+	last_rx = simt;
+
+	while (mcc_size > 0 && mcc_credit >= 1.0 && !sat->agc.IsUpruptActive()) {
+		mcc_credit -= 1.0;
+		rx_data[rx_offset] = mcc_data[mcc_offset];
+		mcc_offset++;
+		// If uplink isn't blocked
+		if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
+			handle_uplink();
+		}
+		// Are we done?
+		if (mcc_offset >= mcc_size) {
+			mcc_offset = mcc_size = 0;
+		}
+	}
+}
+
 // Handle data moved to buffer from either the socket or mcc buffer
 void PCM::handle_uplink() {
 	switch (uplink_state) {
@@ -299,6 +299,7 @@ public:
 	int uplink_state;               // Uplink State
 	void perform_io(double simt);   // Get data from here to there
 	void handle_uplink();	// Handle incoming data
+	void fast_mcc_uplink(double simt); // Feed MCC data at the uplink bit rate
 	void generate_stream_lbr();     // Generate LBR datastream
 	void generate_stream_hbr();     // Same for HBR datastream
 	unsigned char scale_data(double data, double low, double high); // Scale data for PCM transmission
@@ -319,6 +320,8 @@ public:
 	int rx_offset;					// RX offset to use
 	int mcc_offset;					// RX offset into MCC data block
 	int mcc_size;					// Size of MCC data block
+	bool mcc_fast;					// Feed MCC data at the uplink bit rate instead of one byte per 0.1 s
+	double mcc_credit;				// Bytes the fast MCC uplink may still feed
 	int pcm_rate_override;          // Downtelemetry rate override
 	unsigned char tx_data[1024];    // Characters to be transmitted
 	unsigned char rx_data[1024];    // Characters recieved
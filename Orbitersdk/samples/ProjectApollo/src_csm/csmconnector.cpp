@@ -406,6 +406,7 @@ CSMToIUConnector::CSMToIUConnector(CSMcomputer &c, Saturn *s) : agc(c), SaturnCo
 
 {
 	type = CSM_IU_COMMAND;
+	SetSlots(Slots, CSMIU_NUM_SLOTS);
 }
 
 CSMToIUConnector::~CSMToIUConnector()
@@ -646,6 +647,34 @@ bool CSMToIUConnector::ReceiveMessage(Connector *from, ConnectorMessage &m)
 	return false;
 }
 
+void CSMToIUConnector::PublishSlots(double simt)
+
+{
+	if (!connectedTo || !OurVessel)
+	{
+		return;
+	}
+
+	WriteSlot(CSMIU_SLOT_CMC_SIVB_TAKEOVER, OurVessel->GetCMCSIVBTakeover(), simt);
+	WriteSlot(CSMIU_SLOT_CMC_SIVB_IGNITION, OurVessel->GetCMCSIVBIgnitionSequenceStart(), simt);
+	WriteSlot(CSMIU_SLOT_CMC_SIVB_CUTOFF, OurVessel->GetCMCSIVBCutoff(), simt);
+	WriteSlot(CSMIU_SLOT_SIISIVB_DIRECT_STAGING, OurVessel->GetSIISIVbDirectStagingSignal(), simt);
+	WriteSlot(CSMIU_SLOT_TLI_INHIBIT, OurVessel->GetTLIInhibitSignal(), simt);
+	WriteSlot(CSMIU_SLOT_IU_UPTLM_ACCEPT, OurVessel->GetIUUPTLMAccept(), simt);
+	WriteSlot(CSMIU_SLOT_LV_RATE_AUTO_SWITCH_STATE, OurVessel->GetLVRateAutoSwitchState(), simt);
+	WriteSlot(CSMIU_SLOT_TWO_ENGINE_OUT_AUTO_SWITCH_STATE, OurVessel->GetTwoEngineOutAutoSwitchState(), simt);
+	WriteSlot(CSMIU_SLOT_BECO_COMMAND_A, OurVessel->GetBECOSignal(true), simt);
+	WriteSlot(CSMIU_SLOT_BECO_COMMAND_B, OurVessel->GetBECOSignal(false), simt);
+	WriteSlot(CSMIU_SLOT_EDS_BUS_1_POWERED, OurVessel->IsEDSBusPowered(1), simt);
+	WriteSlot(CSMIU_SLOT_EDS_BUS_2_POWERED, OurVessel->IsEDSBusPowered(2), simt);
+	WriteSlot(CSMIU_SLOT_EDS_BUS_3_POWERED, OurVessel->IsEDSBusPowered(3), simt);
+	WriteSlot(CSMIU_SLOT_EDS_UNSAFE_A, OurVessel->GetSECS()->MESCA.EDSUnsafeIndicateSignal(), simt);
+	WriteSlot(CSMIU_SLOT_EDS_UNSAFE_B, OurVessel->GetSECS()->MESCB.EDSUnsafeIndicateSignal(), simt);
+	WriteSlot(CSMIU_SLOT_AGC_ATTITUDE_ERROR_X, OurVessel->GetAGCAttitudeError(0), simt);
+	WriteSlot(CSMIU_SLOT_AGC_ATTITUDE_ERROR_Y, OurVessel->GetAGCAttitudeError(1), simt);
+	WriteSlot(CSMIU_SLOT_AGC_ATTITUDE_ERROR_Z, OurVessel->GetAGCAttitudeError(2), simt);
+}
+
 bool CSMToIUConnector::GetLiftOffCircuit(bool sysA)
 {
 	ConnectorMessage cm;
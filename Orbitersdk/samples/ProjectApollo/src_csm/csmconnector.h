@@ -44,6 +44,34 @@ protected:
 	Saturn *OurVessel;
 };
 
+///
+/// \ingroup Connectors
+/// \brief Values the CSM publishes to the IU every timestep.
+///
+enum CSMIUSlot
+{
+	CSMIU_SLOT_CMC_SIVB_TAKEOVER,
+	CSMIU_SLOT_CMC_SIVB_IGNITION,
+	CSMIU_SLOT_CMC_SIVB_CUTOFF,
+	CSMIU_SLOT_SIISIVB_DIRECT_STAGING,
+	CSMIU_SLOT_TLI_INHIBIT,
+	CSMIU_SLOT_IU_UPTLM_ACCEPT,
+	CSMIU_SLOT_LV_RATE_AUTO_SWITCH_STATE,
+	CSMIU_SLOT_TWO_ENGINE_OUT_AUTO_SWITCH_STATE,
+	CSMIU_SLOT_BECO_COMMAND_A,
+	CSMIU_SLOT_BECO_COMMAND_B,
+	CSMIU_SLOT_EDS_BUS_1_POWERED,
+	CSMIU_SLOT_EDS_BUS_2_POWERED,
+	CSMIU_SLOT_EDS_BUS_3_POWERED,
+	CSMIU_SLOT_EDS_UNSAFE_A,
+	CSMIU_SLOT_EDS_UNSAFE_B,
+	CSMIU_SLOT_AGC_ATTITUDE_ERROR_X,
+	CSMIU_SLOT_AGC_ATTITUDE_ERROR_Y,
+	CSMIU_SLOT_AGC_ATTITUDE_ERROR_Z,
+
+	CSMIU_NUM_SLOTS
+};
+
 ///
 /// \ingroup Connectors
 /// \brief CSM to IU connector type.
@@ -56,6 +84,11 @@ public:
 
 	bool ReceiveMessage(Connector *from, ConnectorMessage &m);
 
+	///
+	/// \brief Write the values the IU reads every timestep, so it doesn't need a message for each.
+	///
+	void PublishSlots(double simt);
+
 	bool GetLiftOffCircuit(bool sysA);
 	bool GetEDSAbort(int n);
 	double GetLVTankPressure(int n);
@@ -65,6 +98,7 @@ public:
 
 protected:
 	CSMcomputer &agc;
+	ConnectorSlot Slots[CSMIU_NUM_SLOTS];
 };
 
 ///
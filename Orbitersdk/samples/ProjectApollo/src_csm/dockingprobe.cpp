@@ -33,6 +33,7 @@
 #include "nasspsound.h"
 #include "powersource.h"
 #include "dockingprobe.h"
+#include "VesselProximity.h"
 #include "nasspdefs.h"
 
 #include "toggleswitch.h"
@@ -255,47 +256,45 @@ void DockingProbe::TimeStep(double simt, double simdt)
 		// Code that follows is largely lifted from Atlantis...
 		// Goal is to handle close proximity docking between a probe and drogue
 
-		VECTOR3 gdrgPos, gdrgDir, gprbPos, gprbDir, gvslPos, rvel, pos, dir, rot;
+		VECTOR3 gdrgPos, gdrgDir, gprbPos, gprbDir, rvel, pos, dir, rot;
 		OurVessel->Local2Global (Dockparam[0],gprbPos);  //converts probe location to global
 		OurVessel->GlobalRot (Dockparam[1],gprbDir);     //rotates probe direction to global
 
-		// Search the complete vessel list for a grappling candidate.
-		// Not very scalable ...
-		for (DWORD i = 0; i < oapiGetVesselCount(); i++) {
-			OBJHANDLE hV = oapiGetVesselByIndex (i);
+		// Search the vessels in range for a grappling candidate.
+		std::vector<OBJHANDLE> candidates;
+		VesselProximity::Find(gprbPos, 0.0, candidates);
+		for (unsigned i = 0; i < candidates.size(); i++) {
+			OBJHANDLE hV = candidates[i];
 			if (hV == OurVessel->GetHandle()) continue; // we don't want to grapple ourselves ...
-			oapiGetGlobalPos (hV, &gvslPos);
-			if (dist (gvslPos, gprbPos) < oapiGetSize (hV)) { // in range
-				VESSEL *v = oapiGetVesselInterface (hV);
-				DWORD nAttach = v->AttachmentCount (true);
-				for (DWORD j = 0; j < nAttach; j++) { // now scan all attachment points of the candidate
-					ATTACHMENTHANDLE hAtt = v->GetAttachmentHandle (true, j);
-					const char *id = v->GetAttachmentId (hAtt);
-					if (strncmp (id, "PADROGUE", 8)) continue; // attachment point not compatible
-					v->GetAttachmentParams (hAtt, pos, dir, rot);
-					v->Local2Global (pos, gdrgPos);  // converts found drogue position to global
-					v->GlobalRot (dir, gdrgDir);     // rotates found drogue direction to global
-					if (dist (gdrgPos, gprbPos) < COLLISION_DETECT_RANGE && DockingMethod == ADVANCEDPHYSICS) { // found one less than a meter away!
-						//  Detect if collision has happend, if so, t will return intersection point along the probe line X(t) = gprbPos + t * gprbDir
-						double t = CollisionDetection(gprbPos, gprbDir, gdrgPos, gdrgDir);	
-						//  Calculate time of penetration according to current velocity
-						OurVessel->GetRelativeVel(hV, rvel);
-						//  Determine resultant force
-
-						//APPLY rforce to DockingProbe Vessel, and APPLY -rforce to Drogue Vessel
-						return;
-					} 
-					if (dist(gdrgPos, gprbPos) < CAPTURE_DETECT_RANGE && DockingMethod > ADVANCED) {
-						// If we're within capture range, set docking port to attachment so docking can take place
-						// Originally, I would have used the Attachment features to soft dock and move the LM during retract
-						// but Artlav's docking method does this better and uses the docking port itself.
-						// Attachment is being used as a placeholder for the docking port and to identify its orientation.
-						OurVessel->GetAttachmentParams(hattPROBE, pos, dir, rot);
-						DOCKHANDLE dock = OurVessel->GetDockHandle(ourPort);
-						OurVessel->SetDockParams(dock, pos, dir, rot);
-					}
-				}//for nAttach
-			}//if inRange
+			VESSEL *v = oapiGetVesselInterface (hV);
+			DWORD nAttach = v->AttachmentCount (true);
+			for (DWORD j = 0; j < nAttach; j++) { // now scan all attachment points of the candidate
+				ATTACHMENTHANDLE hAtt = v->GetAttachmentHandle (true, j);
+				const char *id = v->GetAttachmentId (hAtt);
+				if (strncmp (id, "PADROGUE", 8)) continue; // attachment point not compatible
+				v->GetAttachmentParams (hAtt, pos, dir, rot);
+				v->Local2Global (pos, gdrgPos);  // converts found drogue position to global
+				v->GlobalRot (dir, gdrgDir);     // rotates found drogue direction to global
+				if (dist (gdrgPos, gprbPos) < COLLISION_DETECT_RANGE && DockingMethod == ADVANCEDPHYSICS) { // found one less than a meter away!
+					//  Detect if collision has happend, if so, t will return intersection point along the probe line X(t) = gprbPos + t * gprbDir
+					double t = CollisionDetection(gprbPos, gprbDir, gdrgPos, gdrgDir);	
+					//  Calculate time of penetration according to current velocity
+					OurVessel->GetRelativeVel(hV, rvel);
+					//  Determine resultant force
+
+					//APPLY rforce to DockingProbe Vessel, and APPLY -rforce to Drogue Vessel
+					return;
+				} 
+				if (dist(gdrgPos, gprbPos) < CAPTURE_DETECT_RANGE && DockingMethod > ADVANCED) {
+					// If we're within capture range, set docking port to attachment so docking can take place
+					// Originally, I would have used the Attachment features to soft dock and move the LM during retract
+					// but Artlav's docking method does this better and uses the docking port itself.
+					// Attachment is being used as a placeholder for the docking port and to identify its orientation.
+					OurVessel->GetAttachmentParams(hattPROBE, pos, dir, rot);
+					DOCKHANDLE dock = OurVessel->GetDockHandle(ourPort);
+					OurVessel->SetDockParams(dock, pos, dir, rot);
+				}
+			}//for nAttach
 		}//for nVessel
 	}
 }
@@ -609,6 +609,21 @@ void Saturn::SystemsTimestep(double simt, double simdt, double mjd) {
 		agc.Timestep(MissionTime, simdt);
 		optics.TimeStep(simdt);
 
+		// The DSKY panel areas are only redrawn when their displays changed
+		if (dsky.CheckRedraw()) {
+			TriggerPanelRedrawArea(PanelId, AID_DSKY_DISPLAY);
+			TriggerPanelRedrawArea(PanelId, AID_DSKY_LIGHTS);
+		}
+		if (dsky2.CheckRedraw()) {
+			TriggerPanelRedrawArea(PanelId, AID_DSKY2_DISPLAY);
+			TriggerPanelRedrawArea(PanelId, AID_DSKY2_LIGHTS);
+		}
+
+		//
+		// Values the IU reads every timestep, written after the AGC has run and before the IU.
+		//
+		iuCommandConnector.PublishSlots(oapiGetSimTime());
+
 		//
 		// If we've seperated from the SIVb, the IU is history.
 		//
@@ -34,6 +34,7 @@
 #include "saturn.h"
 #include "tracer.h"
 #include "papi.h"
+#include "NamedObjects.h"
 
 #include <time.h>
 
@@ -5204,7 +5205,7 @@ void EMS::AccelerometerTimeStep(double simdt) {
 VECTOR3 EMS::GetGravityVector()
 {
 	OBJHANDLE gravref = sat->GetGravityRef();
-	OBJHANDLE hSun = oapiGetObjectByName("Sun");
+	OBJHANDLE hSun = NamedObjects::Sun();
 	VECTOR3 R, U_R;
 	sat->GetRelativePos(gravref, R);
 	U_R = unit(R);
@@ -5257,9 +5258,9 @@ VECTOR3 EMS::GetGravityVector()
 	a_dP *= mu / pow(r, 2.0);
 	a_dP -= U_R_S * mu_S / pow(r_S, 2.0);
 
-	if (gravref == oapiGetObjectByName("Moon"))
+	if (gravref == NamedObjects::Moon())
 	{
-		OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+		OBJHANDLE hEarth = NamedObjects::Earth();
 
 		VECTOR3 R_Ea, U_R_E;
 		sat->GetRelativePos(hEarth, R_Ea);
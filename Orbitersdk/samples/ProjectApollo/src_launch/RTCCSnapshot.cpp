@@ -0,0 +1,538 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Binary Table Snapshot
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "Orbitersdk.h"
+#include <cstring>
+#include <set>
+#include "soundlib.h"
+#include "apolloguidance.h"
+#include "mcc.h"
+#include "rtcc.h"
+#include "RTCCSnapshot.h"
+
+static const char RTCCSnapshotMagic[8] = { 'N','A','S','S','P','R','T','C' };
+
+struct RTCCSnapshotHeader
+{
+	char Magic[8];
+	unsigned Version;
+	//Size of the raw records, guards against files written by a build with a different struct layout
+	unsigned SizeEphemerisData;
+	unsigned SizeREFSMMATData;
+	unsigned SizeMANTIMESData;
+	//Size of the data following the header
+	unsigned PayloadSize;
+};
+
+//Appends table data to a memory buffer
+class RTCCSnapshotWriter
+{
+public:
+	RTCCSnapshotWriter() : err(false) {}
+
+	void Raw(const void *data, size_t size)
+	{
+		const char *p = (const char *)data;
+		buf.insert(buf.end(), p, p + size);
+	}
+	template <typename T> void Item(T &val)
+	{
+		Raw(&val, sizeof(T));
+	}
+	void Item(std::string &val)
+	{
+		unsigned len = val.size();
+		Item(len);
+		Raw(val.data(), len);
+	}
+	void Item(std::bitset<4> &val)
+	{
+		unsigned long bits = val.to_ulong();
+		Item(bits);
+	}
+	template <typename T> void Vector(std::vector<T> &val)
+	{
+		unsigned num = val.size();
+		Item(num);
+		if (num > 0)
+		{
+			Raw(&val[0], num * sizeof(T));
+		}
+	}
+
+	std::vector<char> buf;
+	bool err;
+};
+
+//Reads table data from a memory mapped view, all reads are bounds checked
+class RTCCSnapshotReader
+{
+public:
+	RTCCSnapshotReader(const char *data, size_t size) : p(data), end(data + size), err(false) {}
+
+	void Raw(void *data, size_t size)
+	{
+		if (err || (size_t)(end - p) < size)
+		{
+			err = true;
+			return;
+		}
+		memcpy(data, p, size);
+		p += size;
+	}
+	template <typename T> void Item(T &val)
+	{
+		Raw(&val, sizeof(T));
+	}
+	void Item(std::string &val)
+	{
+		unsigned len = 0;
+		Item(len);
+		if (err || (size_t)(end - p) < len)
+		{
+			err = true;
+			return;
+		}
+		val.assign(p, len);
+		p += len;
+	}
+	void Item(std::bitset<4> &val)
+	{
+		unsigned long bits = 0;
+		Item(bits);
+		val = std::bitset<4>(bits);
+	}
+	template <typename T> void Vector(std::vector<T> &val)
+	{
+		unsigned num = 0;
+		Item(num);
+		if (err || (size_t)(end - p) / sizeof(T) < num)
+		{
+			err = true;
+			return;
+		}
+		val.resize(num);
+		if (num > 0)
+		{
+			Raw(&val[0], num * sizeof(T));
+		}
+	}
+
+	const char *p, *end;
+	bool err;
+};
+
+//The same field list is used for writing and reading
+
+template <class A> static void SnapshotTable(A &ar, MPTVehicleDataBlock &blk)
+{
+	ar.Item(blk.ConfigCode);
+	ar.Item(blk.ConfigChangeInd);
+	ar.Item(blk.TUP);
+	ar.Item(blk.CSMArea);
+	ar.Item(blk.SIVBArea);
+	ar.Item(blk.LMAscentArea);
+	ar.Item(blk.LMDescentArea);
+	ar.Item(blk.CSMMass);
+	ar.Item(blk.SIVBMass);
+	ar.Item(blk.LMAscentMass);
+	ar.Item(blk.LMDescentMass);
+	ar.Item(blk.CSMRCSFuelRemaining);
+	ar.Item(blk.SPSFuelRemaining);
+	ar.Item(blk.SIVBFuelRemaining);
+	ar.Item(blk.LMRCSFuelRemaining);
+	ar.Item(blk.LMAPSFuelRemaining);
+	ar.Item(blk.LMDPSFuelRemaining);
+}
+
+template <class A> static void SnapshotTable(A &ar, MPTManeuver &man)
+{
+	ar.Item(man.code);
+	SnapshotTable(ar, man.CommonBlock);
+	ar.Item(man.StationIDFrozen);
+	ar.Item(man.GMTFrozen);
+	ar.Item(man.AttitudeCode);
+	ar.Item(man.Thruster);
+	ar.Item(man.UllageThrusterOpt);
+	ar.Item(man.AttitudesInput);
+	ar.Item(man.ConfigCodeBefore);
+	ar.Item(man.TVC);
+	ar.Item(man.TrimAngleInd);
+	ar.Item(man.FrozenManeuverInd);
+	ar.Item(man.RefBodyInd);
+	ar.Item(man.CoordSysInd);
+	ar.Item(man.HeadsUpDownInd);
+	ar.Item(man.DockingAngle);
+	ar.Item(man.GMTMAN);
+	ar.Item(man.dt_ullage);
+	ar.Item(man.DT_10PCT);
+	ar.Item(man.dt);
+	ar.Item(man.dv);
+	ar.Item(man.A_T);
+	ar.Item(man.X_B);
+	ar.Item(man.Y_B);
+	ar.Item(man.Z_B);
+	ar.Item(man.FrozenManeuverVector);
+	ar.Item(man.DPSScaleFactor);
+	ar.Item(man.dV_inertial);
+	ar.Item(man.dV_LVLH);
+	//Unions are stored by their widest member
+	ar.Item(man.Word67d);
+	ar.Item(man.Word68);
+	ar.Item(man.Word69);
+	ar.Item(man.Word70);
+	ar.Item(man.Word71);
+	ar.Item(man.Word72);
+	ar.Item(man.Word73);
+	ar.Item(man.Word74);
+	ar.Item(man.Word75);
+	ar.Item(man.Word76);
+	ar.Item(man.Word77);
+	ar.Item(man.Word78d);
+	ar.Item(man.Word79);
+	ar.Item(man.Word80);
+	ar.Item(man.Word81);
+	ar.Item(man.Word82);
+	ar.Item(man.Word83);
+	ar.Item(man.Word84);
+	ar.Item(man.GMTI);
+	ar.Item(man.TrajDet);
+	ar.Item(man.R_BI);
+	ar.Item(man.V_BI);
+	ar.Item(man.GMT_BI);
+	ar.Item(man.R_BO);
+	ar.Item(man.V_BO);
+	ar.Item(man.GMT_BO);
+	ar.Item(man.R_1);
+	ar.Item(man.V_1);
+	ar.Item(man.GMT_1);
+	ar.Item(man.TotalMassAfter);
+	ar.Item(man.TotalAreaAfter);
+	ar.Item(man.MainEngineFuelUsed);
+	ar.Item(man.RCSFuelUsed);
+	ar.Item(man.DVREM);
+	ar.Item(man.DVC);
+	ar.Item(man.DVXBT);
+	ar.Item(man.DV_M);
+	ar.Item(man.V_F);
+	ar.Item(man.V_S);
+	ar.Item(man.V_D);
+	ar.Item(man.P_H);
+	ar.Item(man.Y_H);
+	ar.Item(man.R_H);
+	ar.Item(man.dt_BD);
+	ar.Item(man.dt_TO);
+	ar.Item(man.dv_TO);
+	ar.Item(man.P_G);
+	ar.Item(man.Y_G);
+	ar.Item(man.lat_BI);
+	ar.Item(man.lng_BI);
+	ar.Item(man.h_BI);
+	ar.Item(man.eta_BI);
+	ar.Item(man.e_BO);
+	ar.Item(man.i_BO);
+	ar.Item(man.g_BO);
+	ar.Item(man.h_a);
+	ar.Item(man.lat_a);
+	ar.Item(man.lng_a);
+	ar.Item(man.GMT_a);
+	ar.Item(man.h_p);
+	ar.Item(man.lat_p);
+	ar.Item(man.lng_p);
+	ar.Item(man.GMT_p);
+	ar.Item(man.GMT_AN);
+	ar.Item(man.lng_AN);
+	ar.Item(man.IMPT);
+}
+
+template <class A> static void SnapshotTable(A &ar, MissionPlanTable &mpt)
+{
+	unsigned num;
+
+	ar.Item(mpt.ManeuverNum);
+	ar.Item(mpt.MaxManeuverNum);
+	ar.Item(mpt.StationID);
+	ar.Item(mpt.GMTAV);
+	ar.Item(mpt.KFactor);
+	ar.Item(mpt.LMStagingGMT);
+	ar.Item(mpt.UpcomingManeuverGMT);
+	ar.Item(mpt.SIVBVentingBeginGET);
+	SnapshotTable(ar, mpt.CommonBlock);
+	ar.Item(mpt.TotalInitMass);
+	ar.Item(mpt.ConfigurationArea);
+	ar.Item(mpt.DeltaDockingAngle);
+	ar.Item(mpt.TimeToBeginManeuver);
+	ar.Item(mpt.TimeToEndManeuver);
+	ar.Item(mpt.AreaAfterManeuver);
+	ar.Item(mpt.WeightAfterManeuver);
+	ar.Item(mpt.LastFrozenManeuver);
+	ar.Item(mpt.LastExecutedManeuver);
+
+	num = mpt.mantable.size();
+	ar.Item(num);
+	if (num != mpt.mantable.size())
+	{
+		//Reading, the table is still empty
+		if (num > mpt.MaxManeuverNum)
+		{
+			ar.err = true;
+			return;
+		}
+		mpt.mantable.resize(num);
+	}
+	for (unsigned i = 0; i < num && !ar.err; i++)
+	{
+		SnapshotTable(ar, mpt.mantable[i]);
+	}
+}
+
+template <class A> static void SnapshotTable(A &ar, RTCC::OrbitEphemerisTable &eph)
+{
+	ar.Item(eph.EPHEM.Header);
+	ar.Vector(eph.EPHEM.table);
+	ar.Item(eph.MANTIMES.TUP);
+	ar.Vector(eph.MANTIMES.Table);
+	ar.Item(eph.LUNRSTAY);
+}
+
+template <class A> static void SnapshotTable(A &ar, OrbitStationContactsTable &tab)
+{
+	for (unsigned i = 0; i < 45; i++)
+	{
+		StationContact &sta = tab.Stations[i];
+
+		ar.Item(sta.GMTAOS);
+		ar.Item(sta.GMTLOS);
+		ar.Item(sta.GMTEMAX);
+		ar.Item(sta.MAXELEV);
+		ar.Item(sta.StationID);
+		ar.Item(sta.BestAvailableAOS);
+		ar.Item(sta.BestAvailableLOS);
+		ar.Item(sta.BestAvailableEMAX);
+		ar.Item(sta.REV);
+	}
+}
+
+//Tables are loaded into a copy first, so that a bad file doesn't leave the RTCC half updated
+struct RTCCSnapshotTables
+{
+	RTCC::OrbitEphemerisTable EZEPH1, EZEPH2;
+	MissionPlanTable PZMPTCSM, PZMPTLEM;
+	REFSMMATLocker EZJGMTX1, EZJGMTX3;
+	OrbitStationContactsTable EZSTACT1, EZSTACT3;
+};
+
+template <class A, class T> static void SnapshotTables(A &ar, T &tab)
+{
+	SnapshotTable(ar, tab.EZEPH1);
+	SnapshotTable(ar, tab.EZEPH2);
+	SnapshotTable(ar, tab.PZMPTCSM);
+	SnapshotTable(ar, tab.PZMPTLEM);
+	ar.Item(tab.EZJGMTX1);
+	ar.Item(tab.EZJGMTX3);
+	SnapshotTable(ar, tab.EZSTACT1);
+	SnapshotTable(ar, tab.EZSTACT3);
+}
+
+static void SnapshotHeader(RTCCSnapshotHeader &head)
+{
+	memcpy(head.Magic, RTCCSnapshotMagic, sizeof(head.Magic));
+	head.Version = RTCC_SNAPSHOT_VERSION;
+	head.SizeEphemerisData = sizeof(EphemerisData);
+	head.SizeREFSMMATData = sizeof(REFSMMATData);
+	head.SizeMANTIMESData = sizeof(MANTIMESData);
+	head.PayloadSize = 0;
+}
+
+bool RTCCSnapshot::Save(RTCC *rtcc, const char *file)
+{
+	RTCCSnapshotWriter ar;
+	RTCCSnapshotHeader head;
+	FILE *f;
+	bool ok;
+
+	SnapshotHeader(head);
+	ar.Item(head);
+	SnapshotTables(ar, *rtcc);
+	head.PayloadSize = ar.buf.size() - sizeof(head);
+	memcpy(&ar.buf[0], &head, sizeof(head));
+
+	f = fopen(file, "wb");
+	if (f == NULL)
+	{
+		return false;
+	}
+	ok = fwrite(&ar.buf[0], 1, ar.buf.size(), f) == ar.buf.size();
+	fclose(f);
+	return ok;
+}
+
+bool RTCCSnapshot::Load(RTCC *rtcc, const char *file)
+{
+	RTCCSnapshotHeader head, ref;
+	RTCCSnapshotTables tab;
+	HANDLE hFile, hMap;
+	const char *view;
+	DWORD size;
+	bool ok = false;
+
+	hFile = CreateFile(file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	size = GetFileSize(hFile, NULL);
+	if (size == INVALID_FILE_SIZE || size < sizeof(RTCCSnapshotHeader))
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+	hMap = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (hMap == NULL)
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+	view = (const char *)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+	if (view != NULL)
+	{
+		RTCCSnapshotReader ar(view, size);
+
+		SnapshotHeader(ref);
+		ar.Item(head);
+		if (memcmp(head.Magic, ref.Magic, sizeof(head.Magic)) == 0 && head.Version == ref.Version && head.SizeEphemerisData == ref.SizeEphemerisData &&
+			head.SizeREFSMMATData == ref.SizeREFSMMATData && head.SizeMANTIMESData == ref.SizeMANTIMESData && head.PayloadSize == size - sizeof(head))
+		{
+			SnapshotTables(ar, tab);
+			ok = !ar.err;
+		}
+		UnmapViewOfFile(view);
+	}
+	CloseHandle(hMap);
+	CloseHandle(hFile);
+
+	if (!ok)
+	{
+		return false;
+	}
+
+	rtcc->EZEPH1 = std::move(tab.EZEPH1);
+	rtcc->EZEPH2 = std::move(tab.EZEPH2);
+	rtcc->PZMPTCSM = std::move(tab.PZMPTCSM);
+	rtcc->PZMPTLEM = std::move(tab.PZMPTLEM);
+	rtcc->EZJGMTX1 = tab.EZJGMTX1;
+	rtcc->EZJGMTX3 = tab.EZJGMTX3;
+	rtcc->EZSTACT1 = tab.EZSTACT1;
+	rtcc->EZSTACT3 = tab.EZSTACT3;
+	return true;
+}
+
+static const char RTCCSnapshotPrefix[] = ".\\Config\\ProjectApollo\\RTCC\\Snapshot_";
+
+std::string RTCCSnapshot::FileName(double MJD)
+{
+	char Buffer[128];
+
+	sprintf_s(Buffer, "%s%.8lf.dat", RTCCSnapshotPrefix, MJD);
+	return Buffer;
+}
+
+//Collects the snapshot names referenced by all scenario files in a folder and its subfolders
+static void FindSnapshotReferences(const std::string &dir, std::set<std::string> &refs)
+{
+	WIN32_FIND_DATA fd;
+	HANDLE hFind;
+	std::string path;
+	char line[512];
+	char *end;
+	FILE *f;
+
+	hFind = FindFirstFile((dir + "\\*").c_str(), &fd);
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+	do
+	{
+		if (fd.cFileName[0] == '.')
+		{
+			continue;
+		}
+		path = dir + "\\" + fd.cFileName;
+		if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			FindSnapshotReferences(path, refs);
+			continue;
+		}
+		end = strrchr(fd.cFileName, '.');
+		if (end == NULL || _stricmp(end, ".scn") != 0)
+		{
+			continue;
+		}
+		f = fopen(path.c_str(), "r");
+		if (f == NULL)
+		{
+			continue;
+		}
+		while (fgets(line, sizeof(line), f))
+		{
+			char *s = strstr(line, "RTCC_SNAPSHOT ");
+			if (s == NULL)
+			{
+				continue;
+			}
+			s += 14;
+			end = s + strcspn(s, " \t\r\n");
+			*end = 0;
+			refs.insert(s);
+		}
+		fclose(f);
+	} while (FindNextFile(hFind, &fd));
+	FindClose(hFind);
+}
+
+void RTCCSnapshot::DeleteUnreferenced(const char *keep)
+{
+	WIN32_FIND_DATA fd;
+	HANDLE hFind;
+	std::set<std::string> refs;
+	std::string file;
+
+	FindSnapshotReferences(".\\Scenarios", refs);
+	refs.insert(keep);
+
+	hFind = FindFirstFile((std::string(RTCCSnapshotPrefix) + "*.dat").c_str(), &fd);
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+	do
+	{
+		file = std::string(".\\Config\\ProjectApollo\\RTCC\\") + fd.cFileName;
+		if (refs.find(file) == refs.end())
+		{
+			remove(file.c_str());
+		}
+	} while (FindNextFile(hFind, &fd));
+	FindClose(hFind);
+}
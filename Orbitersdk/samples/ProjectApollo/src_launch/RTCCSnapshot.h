@@ -0,0 +1,46 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Binary Table Snapshot (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <string>
+
+class RTCC;
+
+//Increment when the layout of any saved table changes, older files are then ignored
+#define RTCC_SNAPSHOT_VERSION 1
+
+//Binary copy of the RTCC ephemeris, mission plan, REFSMMAT and station contact tables.
+//The scenario only stores the file name, the tables are read back from a memory mapped view of the file.
+class RTCCSnapshot
+{
+public:
+	//Writes the tables to file, returns false on error
+	static bool Save(RTCC *rtcc, const char *file);
+	//Reads the tables from file, returns false and leaves the RTCC untouched if the file is missing or invalid
+	static bool Load(RTCC *rtcc, const char *file);
+	//Default file name for a snapshot taken at the given MJD
+	static std::string FileName(double MJD);
+	//Deletes all snapshot files that no scenario in the Scenarios folder refers to, except for the given one
+	static void DeleteUnreferenced(const char *keep);
+};
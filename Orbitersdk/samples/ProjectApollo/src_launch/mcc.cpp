@@ -217,6 +217,7 @@ MCC::MCC(OBJHANDLE hVessel, int flightmodel)
 	CM_DeepSpace = false;
 	GT_Enabled = false;
 	MT_Enabled = false;
+	FastUplink = false;
 	AbortMode = 0;
 	LastAOSUpdate=0;
 	CM_MoonPosition[0] = 0;
@@ -1268,6 +1269,7 @@ int MCC::CM_uplink(const unsigned char *data, int len) {
 	if (len > remsize) { return -2; } // Too long!
 	memcpy((cm->pcm.mcc_data+cm->pcm.mcc_size), data, len);
 	cm->pcm.mcc_size += len;
+	cm->pcm.mcc_fast = FastUplink;
 	return len;
 }
 
@@ -1279,6 +1281,7 @@ int MCC::LM_uplink(const unsigned char *data, int len) {
 	if (len > remsize) { return -2; } // Too long!
 	memcpy((lm->VHF.mcc_data + lm->VHF.mcc_size), data, len);
 	lm->VHF.mcc_size += len;
+	lm->VHF.mcc_fast = FastUplink;
 	return len;
 }
 
@@ -1380,6 +1383,7 @@ void MCC::SaveState(FILEHANDLE scn) {
 	// Booleans
 	SAVE_BOOL("MCC_GT_Enabled", GT_Enabled);	
 	SAVE_BOOL("MCC_MT_Enabled", MT_Enabled);
+	SAVE_BOOL("MCC_FastUplink", FastUplink);
 	SAVE_BOOL("MCC_padAutoShow", padAutoShow);
 	SAVE_BOOL("MCC_PCOption_Enabled", PCOption_Enabled);
 	SAVE_BOOL("MCC_NCOption_Enabled", NCOption_Enabled);
@@ -1913,6 +1917,7 @@ void MCC::LoadState(FILEHANDLE scn) {
 		}
 		LOAD_BOOL("MCC_GT_Enabled", GT_Enabled);
 		LOAD_BOOL("MCC_MT_Enabled", MT_Enabled);
+		LOAD_BOOL("MCC_FastUplink", FastUplink);
 		LOAD_BOOL("MCC_padAutoShow", padAutoShow);
 		LOAD_BOOL("MCC_PCOption_Enabled", PCOption_Enabled);
 		LOAD_BOOL("MCC_NCOption_Enabled", NCOption_Enabled);
@@ -3401,10 +3406,25 @@ void MCC::keyDown(DWORD key){
 				menuState = 0;
 			}
 			if (menuState == 1) {
-				oapiAnnotationSetText(NHmenu, "DEBUG MENU\n1: Toggle GT\n2: Toggle MT\n3: Report State\n4: Inc State\n5: Dec State\n6: Inc SubState\n7: Dec SubState\n8: Reset State\n9: Reset SubState"); // Debug menu
+				oapiAnnotationSetText(NHmenu, "DEBUG MENU\n1: Toggle GT\n2: Toggle MT\n3: Report State\n4: Inc State\n5: Dec State\n6: Inc SubState\n7: Dec SubState\n8: Reset State\n9: Reset SubState\n0: Toggle Fast Uplink"); // Debug menu
 				menuState = 2;
 			}
 			break;
+		case OAPI_KEY_0:
+			if (menuState == 2) {
+				if (FastUplink == false) {
+					FastUplink = true;
+					sprintf(buf, "Fast Uplink Enabled");
+				}
+				else {
+					FastUplink = false;
+					sprintf(buf, "Fast Uplink Disabled");
+				}
+				addMessage(buf);
+				oapiAnnotationSetText(NHmenu, ""); // Clear menu
+				menuState = 0;
+			}
+			break;
 
 	}
 }
@@ -296,6 +296,7 @@ public:
 	bool   CM_DeepSpace;                                    // CM Deep Space Mode flag (Not in Earth's SOI)
 	bool   GT_Enabled;										// Ground tracking enable/disable
 	bool   MT_Enabled;										// Mission status tracking enable/disable
+	bool   FastUplink;										// Uplink at the uplink bit rate instead of one byte per 0.1 s
 
 	// MISSION STATE
 	int MissionType;										// Mission Type
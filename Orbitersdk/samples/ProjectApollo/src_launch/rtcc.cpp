@@ -42,6 +42,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/GeneralizedIterator.h"
 #include "mcc.h"
 #include "rtcc.h"
+#include "../src_rtccmfd/VesselStates.h"
 
 // SCENARIO FILE MACROLOGY
 #define SAVE_BOOL(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
@@ -57,6 +58,17 @@ See http://nassp.sourceforge.net/license/ for more details.
 #define LOAD_M3(KEY,VALUE) if(strnicmp(line,KEY,strlen(KEY))==0){ sscanf(line+strlen(KEY),"%lf %lf %lf %lf %lf %lf %lf %lf %lf",&VALUE.m11,&VALUE.m12,&VALUE.m13,&VALUE.m21,&VALUE.m22,&VALUE.m23,&VALUE.m31,&VALUE.m32,&VALUE.m33); }
 #define LOAD_STRING(KEY,VALUE,LEN) if(strnicmp(line,KEY,strlen(KEY))==0){ strncpy(VALUE, line + (strlen(KEY)+1), LEN); }
 
+//Marks a display table as being recalculated for the lifetime of the object, in functions with several return paths
+class DisplayTableUpdate
+{
+public:
+	DisplayTableUpdate(volatile LONG &v) : version(v) { InterlockedIncrement(&version); }
+	~DisplayTableUpdate() { InterlockedIncrement(&version); }
+private:
+	volatile LONG &version;
+};
+
+
 FIDOOrbitDigitals::FIDOOrbitDigitals()
 {
 	A = 0.0;
@@ -3793,17 +3805,20 @@ SV RTCC::StateVectorCalc(VESSEL *vessel, double SVMJD)
 	OBJHANDLE gravref;
 	SV sv, sv1;
 
-	gravref = AGCGravityRef(vessel);
+	if (!PublishedState(vessel, gravref, R, V, sv.MJD, sv.mass))
+	{
+		gravref = AGCGravityRef(vessel);
 
-	vessel->GetRelativePos(gravref, R);
-	vessel->GetRelativeVel(gravref, V);
-	sv.MJD = oapiGetSimMJD();
+		vessel->GetRelativePos(gravref, R);
+		vessel->GetRelativeVel(gravref, V);
+		sv.MJD = oapiGetSimMJD();
+		sv.mass = vessel->GetMass();
+	}
 
 	sv.R = _V(R.x, R.z, R.y);
 	sv.V = _V(V.x, V.z, V.y);
 
 	sv.gravref = gravref;
-	sv.mass = vessel->GetMass();
 
 	if (SVMJD != 0.0)
 	{
@@ -3821,15 +3836,18 @@ SV RTCC::StateVectorCalc(VESSEL *vessel, double SVMJD)
 EphemerisData RTCC::StateVectorCalcEphem(VESSEL *vessel, double SVGMT)
 {
 	VECTOR3 R, V;
-	double MJD;
+	double MJD, mass;
 	OBJHANDLE gravref;
 	EphemerisData sv;
 
-	gravref = AGCGravityRef(vessel);
+	if (!PublishedState(vessel, gravref, R, V, MJD, mass))
+	{
+		gravref = AGCGravityRef(vessel);
 
-	vessel->GetRelativePos(gravref, R);
-	vessel->GetRelativeVel(gravref, V);
-	MJD = oapiGetSimMJD();
+		vessel->GetRelativePos(gravref, R);
+		vessel->GetRelativeVel(gravref, V);
+		MJD = oapiGetSimMJD();
+	}
 
 	sv.R = _V(R.x, R.z, R.y);
 	sv.V = _V(V.x, V.z, V.y);
@@ -3849,6 +3867,16 @@ OBJHANDLE RTCC::AGCGravityRef(VESSEL *vessel)
 {
 	OBJHANDLE gravref;
 	VECTOR3 rsph;
+	VesselState state;
+
+	if (VesselStates::Get(vessel, state))
+	{
+		if (length(state.R_Moon) > 64373760.0)
+		{
+			return state.hEarth;
+		}
+		return state.hMoon;
+	}
 
 	gravref = oapiGetObjectByName("Moon");
 	vessel->GetRelativePos(gravref, rsph);
@@ -3859,6 +3887,33 @@ OBJHANDLE RTCC::AGCGravityRef(VESSEL *vessel)
 	return gravref;
 }
 
+bool RTCC::PublishedState(VESSEL *vessel, OBJHANDLE &gravref, VECTOR3 &R, VECTOR3 &V, double &MJD, double &mass)
+{
+	VesselState state;
+
+	if (!VesselStates::Get(vessel, state))
+	{
+		return false;
+	}
+
+	//Same reference as AGCGravityRef
+	if (length(state.R_Moon) > 64373760.0)
+	{
+		gravref = state.hEarth;
+		R = state.R_Earth;
+		V = state.V_Earth;
+	}
+	else
+	{
+		gravref = state.hMoon;
+		R = state.R_Moon;
+		V = state.V_Moon;
+	}
+	MJD = state.MJD;
+	mass = state.mass;
+	return true;
+}
+
 double RTCC::getGETBase()
 {
 	double GET, SVMJD;
@@ -7942,15 +7997,26 @@ double RTCC::PericynthionTime(VESSEL *vessel)
 {
 	OBJHANDLE gravref;
 	VECTOR3 R_A, V_A, R0, V0;
-	double SVMJD, mu, dt, GETbase;
+	double SVMJD, mu, dt, GETbase, mass;
 
 	GETbase = getGETBase();
-	gravref = AGCGravityRef(vessel);
+	if (!PublishedState(vessel, gravref, R_A, V_A, SVMJD, mass))
+	{
+		gravref = AGCGravityRef(vessel);
 
-	mu = GGRAV*oapiGetMass(gravref);
-	vessel->GetRelativePos(gravref, R_A);
-	vessel->GetRelativeVel(gravref, V_A);
-	SVMJD = oapiGetSimMJD();
+		vessel->GetRelativePos(gravref, R_A);
+		vessel->GetRelativeVel(gravref, V_A);
+		SVMJD = oapiGetSimMJD();
+	}
+
+	if (gravref == hMoon)
+	{
+		mu = OrbMech::mu_Moon;
+	}
+	else
+	{
+		mu = OrbMech::mu_Earth;
+	}
 	R0 = _V(R_A.x, R_A.z, R_A.y);
 	V0 = _V(V_A.x, V_A.z, V_A.y);
 
@@ -13443,6 +13509,8 @@ void RTCC::EMMDYNMC(int L, int queid, int ind, double param)
 		ephtab = &EZEPH2;
 	}
 
+	DisplayTableUpdate update(DisplayTableVersion.FIDOOrbitDigitals[L == 1 ? 0 : 1]);
+
 	double CurGET, CurGMT, R_B;
 
 	CurGMT = RTCCPresentTimeGMT();
@@ -13815,6 +13883,8 @@ int RTCC::EMDSPACE(int queid, int option, double val, double incl, double ascnod
 	//6 = MSK request
 	//7 = Reinitialization
 
+	DisplayTableUpdate update(DisplayTableVersion.SpaceDigitals);
+
 	EZSPACE.errormessage = "";
 
 	if (EZETVMED.SpaceDigVehID < 0)
@@ -18375,6 +18445,8 @@ int RTCC::ELVARY(EphemerisDataTable &EPH, unsigned ORER, double GMT, bool EXTRAP
 
 void RTCC::EMDSTAC()
 {
+	DisplayTableUpdate update(DisplayTableVersion.NextStationContacts);
+
 	double GMT = RTCCPresentTimeGMT();
 	double GET = GETfromGMT(GMT);
 
@@ -19160,24 +19232,179 @@ int RTCC::ELVCNV(VECTOR3 vec, double GMT, int in, int out, VECTOR3 &vec_out)
 
 int RTCC::ELVCNV(EphemerisDataTable &svtab, int in, int out, EphemerisDataTable &svtab_out)
 {
-	EphemerisData sv, sv_out;
-	svtab_out.table.clear();
-	int err = 0;
-	for (unsigned i = 0;i < svtab.table.size();i++)
+	//0 = ECI, 1 = ECT, 2 = MCI, 3 = MCT, 4 = EMP
+	//Next frame on the way to MCI, this gives the same conversion chains as the single vector ELVCNV
+	static const int parent[5] = { 2, 0, -1, 2, 2 };
+
+	std::vector<int> path, path_out;
+	std::vector<double> MJD;
+	std::vector<MATRIX3> Rot_E, Rot_M;
+	std::vector<VECTOR3> R_EM, V_EM;
+	VECTOR3 R_ES;
+	unsigned i, j, n;
+	int a, b, err = 0;
+	bool earth = false, moon = false, ephem = false;
+
+	//Preallocated output, can be the input table
+	if (&svtab_out != &svtab)
 	{
-		sv = svtab.table[i];
-		err = ELVCNV(sv, in, out, sv_out);
-		if (err)
+		svtab_out.table = svtab.table;
+	}
+	n = svtab_out.table.size();
+
+	//Frames from in to out, up to the first frame both have in common and down again
+	if (in >= 0 && in <= 4 && out >= 0 && out <= 4)
+	{
+		for (a = in; a >= 0; a = parent[a]) path.push_back(a);
+		for (a = out; a >= 0; a = parent[a]) path_out.push_back(a);
+		while (path.size() > 1 && path_out.size() > 1 && path[path.size() - 2] == path_out[path_out.size() - 2])
 		{
-			break;
+			path.pop_back();
+			path_out.pop_back();
+		}
+		for (j = path_out.size() - 1; j > 0; j--)
+		{
+			path.push_back(path_out[j - 1]);
 		}
-		svtab_out.table.push_back(sv_out);
 	}
+
+	for (j = 1; j < path.size(); j++)
+	{
+		a = path[j - 1];
+		b = path[j];
+		if (a + b == 1) earth = true;		//ECI/ECT
+		else if (a + b == 5) moon = true;	//MCI/MCT
+		else ephem = true;					//ECI/MCI and MCI/EMP
+	}
+
+	//Time dependent data, evaluated once per vector for the whole conversion chain
+	if (n > 0 && (earth || moon || ephem))
+	{
+		MJD.resize(n);
+		for (i = 0; i < n; i++)
+		{
+			MJD[i] = OrbMech::MJDfromGET(svtab_out.table[i].GMT, GMTBASE);
+		}
+	}
+	if (n > 0 && ephem)
+	{
+		R_EM.resize(n);
+		V_EM.resize(n);
+		for (i = 0; i < n; i++)
+		{
+			if (!OrbMech::PLEFEM(pzefem, MJD[i], R_EM[i], V_EM[i], R_ES))
+			{
+				//Keep the vectors before the error, like a conversion vector by vector
+				err = 1;
+				n = i;
+				svtab_out.table.resize(n);
+				break;
+			}
+		}
+	}
+	if (n > 0 && earth)
+	{
+		Rot_E.resize(n);
+		OrbMech::GetRotationMatrix(BODY_EARTH, &MJD[0], n, &Rot_E[0]);
+	}
+	if (n > 0 && moon)
+	{
+		Rot_M.resize(n);
+		OrbMech::GetRotationMatrix(BODY_MOON, &MJD[0], n, &Rot_M[0]);
+	}
+
+	//Apply each step of the chain to the whole table
+	for (j = 1; j < path.size(); j++)
+	{
+		a = path[j - 1];
+		b = path[j];
+
+		//ECI to/from ECT
+		if (a == 0 && b == 1)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = rhtmul(Rot_E[i], svtab_out.table[i].R);
+				svtab_out.table[i].V = rhtmul(Rot_E[i], svtab_out.table[i].V);
+			}
+		}
+		else if (a == 1 && b == 0)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = rhmul(Rot_E[i], svtab_out.table[i].R);
+				svtab_out.table[i].V = rhmul(Rot_E[i], svtab_out.table[i].V);
+			}
+		}
+		//ECI to/from MCI
+		else if (a == 0 && b == 2)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = svtab_out.table[i].R - R_EM[i];
+				svtab_out.table[i].V = svtab_out.table[i].V - V_EM[i];
+			}
+		}
+		else if (a == 2 && b == 0)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = svtab_out.table[i].R + R_EM[i];
+				svtab_out.table[i].V = svtab_out.table[i].V + V_EM[i];
+			}
+		}
+		//MCI to/from MCT
+		else if (a == 2 && b == 3)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = rhtmul(Rot_M[i], svtab_out.table[i].R);
+				svtab_out.table[i].V = rhtmul(Rot_M[i], svtab_out.table[i].V);
+			}
+		}
+		else if (a == 3 && b == 2)
+		{
+			for (i = 0; i < n; i++)
+			{
+				svtab_out.table[i].R = rhmul(Rot_M[i], svtab_out.table[i].R);
+				svtab_out.table[i].V = rhmul(Rot_M[i], svtab_out.table[i].V);
+			}
+		}
+		//MCI to/from EMP
+		else
+		{
+			MATRIX3 Rot;
+			VECTOR3 X_EMP, Y_EMP, Z_EMP;
+
+			for (i = 0; i < n; i++)
+			{
+				X_EMP = -unit(R_EM[i]);
+				Z_EMP = unit(crossp(R_EM[i], V_EM[i]));
+				Y_EMP = crossp(Z_EMP, X_EMP);
+				Rot = _M(X_EMP.x, X_EMP.y, X_EMP.z, Y_EMP.x, Y_EMP.y, Y_EMP.z, Z_EMP.x, Z_EMP.y, Z_EMP.z);
+
+				if (a == 2)
+				{
+					svtab_out.table[i].R = rhmul(Rot, svtab_out.table[i].R);
+					svtab_out.table[i].V = rhmul(Rot, svtab_out.table[i].V);
+				}
+				else
+				{
+					svtab_out.table[i].R = rhtmul(Rot, svtab_out.table[i].R);
+					svtab_out.table[i].V = rhtmul(Rot, svtab_out.table[i].V);
+				}
+			}
+		}
+	}
+
 	//Store some ephemeris header data
 	svtab_out.Header.CSI = out;
 	svtab_out.Header.NumVec = svtab_out.table.size();
-	svtab_out.Header.TL = svtab_out.table.front().GMT;
-	svtab_out.Header.TR = svtab_out.table.back().GMT;
+	if (n > 0)
+	{
+		svtab_out.Header.TL = svtab_out.table.front().GMT;
+		svtab_out.Header.TR = svtab_out.table.back().GMT;
+	}
 	svtab_out.Header.TUP = svtab.Header.TUP;
 	svtab_out.Header.VEH = svtab.Header.VEH;
 	return err;
@@ -26578,7 +26805,7 @@ int RTCC::GMSMED(std::string med, std::vector<std::string> data)
 		}
 
 		double J_D = TJUDAT(Year, Month, Day);
-		GMTBASE = J_D - 2400000.5;
+		SetGMTBase(J_D - 2400000.5);
 
 		//PIGBHA();
 
@@ -29255,6 +29482,8 @@ void RTCC::PMDTRDFF(int med, unsigned page)
 //Mission Plan Table Display
 void RTCC::PMDMPT()
 {
+	DisplayTableUpdate update(DisplayTableVersion.MissionPlanTable);
+
 	MPTDISPLAY.man.clear();
 
 	char Buffer[100];
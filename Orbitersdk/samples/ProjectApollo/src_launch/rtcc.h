@@ -2655,6 +2655,8 @@ public:
 	bool GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG);
 	bool GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG, GPMPRESULTS &res);
 	OBJHANDLE AGCGravityRef(VESSEL* vessel); // A sun referenced state vector wouldn't be much of a help for the AGC...
+	//State of the vessel published by the RTCC MFD for the current time step, false if there is none
+	bool PublishedState(VESSEL *vessel, OBJHANDLE &gravref, VECTOR3 &R, VECTOR3 &V, double &MJD, double &mass);
 	void NavCheckPAD(SV sv, AP7NAV &pad, double GETbase, double GET = 0.0);
 	void AGSStateVectorPAD(AGSSVOpt *opt, AP11AGSSVPAD &pad);
 	void AP11LMManeuverPAD(AP11LMManPADOpt *opt, AP11LMMNV &pad);
@@ -2852,7 +2854,7 @@ public:
 	void SetGMTLO(double gmt) { MCGMTL = gmt; }
 	double CalcGETBase();
 	double GetGMTBase() { return GMTBASE; }
-	void SetGMTBase(double gmt) { GMTBASE = gmt; }
+	void SetGMTBase(double gmt) { GMTBASE = gmt; OrbMech::SetMatrixTableWindow(gmt); }
 	double GETfromGMT(double GMT);
 	double GMTfromGET(double GET);
 	//Arrival time at selenographic argument of latitude
@@ -3316,6 +3318,17 @@ public:
 	SpaceDigitals EZSPACE;
 	OrbitStationContactsTable EZSTACT1, EZSTACT3;
 	NextStationContactsTable NextStationContactsBuffer;
+
+	//Update counters of the display tables, incremented when a table starts and when it finishes being recalculated.
+	//Displays drawn from a table only have to be rebuilt when its counter changed. They are incremented by calculation threads while the MFD reads them.
+	struct DisplayTableVersions
+	{
+		volatile LONG FIDOOrbitDigitals[2] = { 0, 0 };
+		volatile LONG SpaceDigitals = 0;
+		volatile LONG MissionPlanTable = 0;
+		volatile LONG NextStationContacts = 0;
+	} DisplayTableVersion;
+
 	PredictedSiteAcquisitionTable EZACQ1, EZACQ3, EZDPSAD1, EZDPSAD3;
 	ExperimentalSiteAcquisitionTable EZDPSAD2;
 	LandmarkAcquisitionTable EZLANDU1;
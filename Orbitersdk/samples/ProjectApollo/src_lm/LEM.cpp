@@ -44,6 +44,7 @@
 #include "Mission.h"
 
 #include "connector.h"
+#include "NamedObjects.h"
 
 char trace_file[] = "ProjectApollo LM.log";
 
@@ -106,6 +107,7 @@ DLLCLBK VESSEL *ovcInit(OBJHANDLE hvessel, int flightmodel)
 
 	if (!refcount++) {
 		LEMLoadMeshes();
+		NamedObjects::Invalidate();
 	}
 
 	// VESSELSOUND 
@@ -321,6 +323,7 @@ void LEM::Init()
 
 {
 	DebugLineClearTimer = 0;
+	SlowRateGroupTime = 0;
 
 	ToggleEva=false;
 	CDREVA_IP=false;
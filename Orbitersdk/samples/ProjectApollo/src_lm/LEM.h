@@ -56,6 +56,12 @@
 // Cosmic background temperature in degrees F
 #define CMBG_TEMP -459.584392
 
+///
+/// Period of the slow systems rate group (radiative heat exchange and the ECS
+/// valves which only follow their switches), in seconds.
+///
+#define LM_SLOW_RATE_GROUP_PERIOD 0.1
+
 //
 // Lem state settings from scenario file, passed from CSM.
 //
@@ -700,6 +706,7 @@ public:
 	SURFHANDLE exhaustTex;
 
 	double DebugLineClearTimer;			// Timer for clearing debug line
+	double SlowRateGroupTime;			// Time accumulated for the slow systems rate group
 		
 	// DS20060413 DirectInput stuff
 	// Handle to DLL instance
@@ -1665,8 +1665,8 @@ bool LEM::clbkLoadPanel (int id) {
         // 3 pos Mode control switches
 	    oapiRegisterPanelArea (AID_MODECONTROL,						_R( 1137, 1425, 1385, 1470), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,				  PANEL_MAP_BACKGROUND);
 		// DSKY		
-		oapiRegisterPanelArea (AID_DSKY_DISPLAY,					_R(1370, 1560, 1475, 1736), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea (AID_DSKY_LIGHTS,						_R(1226, 1565, 1328, 1734), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea (AID_DSKY_DISPLAY,					_R(1370, 1560, 1475, 1736), PANEL_REDRAW_USER,   PANEL_MOUSE_DOWN,                PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea (AID_DSKY_LIGHTS,						_R(1226, 1565, 1328, 1734), PANEL_REDRAW_USER,   PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
 		oapiRegisterPanelArea (AID_DSKY_KEY,						_R(1208, 1756, 1494, 1876), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN|PANEL_MOUSE_UP, PANEL_MAP_BACKGROUND);		
 		oapiRegisterPanelArea (AID_MISSION_CLOCK,					_R( 681,  286,  823,  308), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,			  PANEL_MAP_BACKGROUND);
 		oapiRegisterPanelArea (AID_EVENT_TIMER,						_R( 897,  286,  978,  308), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,			  PANEL_MAP_BACKGROUND);
@@ -1737,10 +1737,10 @@ bool LEM::clbkLoadPanel (int id) {
 
 		// DEDA
 		oapiRegisterPanelArea (AID_LM_AGS_OPERATE_SWITCH,            _R(2249, 1835, 2286, 1875), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea (AID_LM_DEDA_DISP,                     _R(2434, 1672, 2568, 1694), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea (AID_LM_DEDA_ADR,                      _R(2458, 1627, 2516, 1649), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea (AID_LM_DEDA_DISP,                     _R(2434, 1672, 2568, 1694), PANEL_REDRAW_USER,   PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea (AID_LM_DEDA_ADR,                      _R(2458, 1627, 2516, 1649), PANEL_REDRAW_USER,   PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
 		oapiRegisterPanelArea (AID_LM_DEDA_KEYS,                     _R(2363, 1710, 2587, 1887), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN | PANEL_MOUSE_UP, PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea (AID_LM_DEDA_LIGHTS,                   _R(2371, 1670, 2418, 1696), PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea (AID_LM_DEDA_LIGHTS,                   _R(2371, 1670, 2418, 1696), PANEL_REDRAW_USER,   PANEL_MOUSE_IGNORE,              PANEL_MAP_BACKGROUND);
 
 		// ORDEAL
 		oapiRegisterPanelArea(AID_ORDEALSWITCHES,					_R(1199, 10, 1676, 212),    PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN | PANEL_MOUSE_LBPRESSED | PANEL_MOUSE_UP, PANEL_MAP_BACKGROUND);
@@ -1851,8 +1851,8 @@ bool LEM::clbkLoadPanel (int id) {
 		oapiRegisterPanelArea(AID_MODECONTROL,                      _R(1669, 878, 1917, 923),   PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                  PANEL_MAP_BACKGROUND);
 		// DSKY
 		oapiRegisterPanelArea(AID_DSKY_KEY,                         _R(1592, 947, 1878, 1067),  PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN | PANEL_MOUSE_UP, PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea(AID_DSKY_DISPLAY,                     _R(1410, 888, 1515, 1065),  PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                  PANEL_MAP_BACKGROUND);
-		oapiRegisterPanelArea(AID_DSKY_LIGHTS,                      _R(1266, 893, 1368, 1062),  PANEL_REDRAW_ALWAYS, PANEL_MOUSE_IGNORE,                PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea(AID_DSKY_DISPLAY,                     _R(1410, 888, 1515, 1065),  PANEL_REDRAW_USER,   PANEL_MOUSE_DOWN,                  PANEL_MAP_BACKGROUND);
+		oapiRegisterPanelArea(AID_DSKY_LIGHTS,                      _R(1266, 893, 1368, 1062),  PANEL_REDRAW_USER,   PANEL_MOUSE_IGNORE,                PANEL_MAP_BACKGROUND);
 
 		oapiRegisterPanelArea(AID_LEFTXPOINTERSWITCH,               _R(1540, 133, 1574, 162),   PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                  PANEL_MAP_BACKGROUND);
 		oapiRegisterPanelArea(AID_GUIDCONTSWITCHROW,                _R(1846, 245, 1881, 441),   PANEL_REDRAW_ALWAYS, PANEL_MOUSE_DOWN,                  PANEL_MAP_BACKGROUND);
@@ -1333,11 +1333,31 @@ void LEM::SystemsInternalTimestep(double simdt)
 	double tFactor = __min(mintFactor, simdt);
 	while (simdt > 0) {
 
-		// Each Timestep is passed to the SPSDK
-		// to perform internal computations on the 
-		// systems.
+		//
+		// Slow rate group, stepped with the time accumulated over the substeps.
+		// The radiative heat exchange changes over seconds and these valves
+		// only follow their switch positions.
+		//
+
+		SlowRateGroupTime += tFactor;
+		if (SlowRateGroupTime >= LM_SLOW_RATE_GROUP_PERIOD) {
+			Panelsdk.ThermalTimestep(SlowRateGroupTime);
+
+			CO2CanisterSelect.SystemTimestep(SlowRateGroupTime);
+			PrimCO2CanisterVent.SystemTimestep(SlowRateGroupTime);
+			SecCO2CanisterVent.SystemTimestep(SlowRateGroupTime);
+			WaterSeparationSelector.SystemTimestep(SlowRateGroupTime);
+			WaterTankSelect.SystemTimestep(SlowRateGroupTime);
+
+			SlowRateGroupTime = 0;
+		}
 
-		Panelsdk.SimpleTimestep(tFactor);
+		//
+		// Fast rate group, every substep. The electrical loads have to be drawn in
+		// every substep, the SPSDK only sees the power drawn since its last step.
+		//
+
+		Panelsdk.SystemsTimestep(tFactor);
 
 		agc.SystemTimestep(tFactor);								// Draw power & generate heat
 		dsky.SystemTimestep(tFactor);								// This can draw power now.
@@ -1371,11 +1391,6 @@ void LEM::SystemsInternalTimestep(double simdt)
 		SuitCircuitReliefValve.SystemTimestep(tFactor);
 		SuitGasDiverter.SystemTimestep(tFactor);
 		CabinGasReturnValve.SystemTimestep(tFactor);
-		CO2CanisterSelect.SystemTimestep(tFactor);
-		PrimCO2CanisterVent.SystemTimestep(tFactor);
-		SecCO2CanisterVent.SystemTimestep(tFactor);
-		WaterSeparationSelector.SystemTimestep(tFactor);
-		WaterTankSelect.SystemTimestep(tFactor);
 		CabinFan.SystemTimestep(tFactor);
 		PrimGlycolPumpController.SystemTimestep(tFactor);
 		SuitFanDPSensor.SystemTimestep(tFactor);
@@ -1423,6 +1438,19 @@ void LEM::SystemsTimestep(double simt, double simdt)
 	asa.Timestep(simdt);									// Do work
 	aea.Timestep(MissionTime, simdt);
 	deda.Timestep(simdt);
+
+	// The DSKY and DEDA panel areas are only redrawn when their displays changed
+	if (dsky.CheckRedraw()) {
+		TriggerPanelRedrawArea(PanelId, AID_DSKY_DISPLAY);
+		TriggerPanelRedrawArea(PanelId, AID_DSKY_LIGHTS);
+		oapiVCTriggerRedrawArea(-1, AID_VC_DSKY_DISPLAY);
+		oapiVCTriggerRedrawArea(-1, AID_VC_DSKY_LIGHTS);
+	}
+	if (deda.CheckRedraw()) {
+		TriggerPanelRedrawArea(PanelId, AID_LM_DEDA_DISP);
+		TriggerPanelRedrawArea(PanelId, AID_LM_DEDA_ADR);
+		TriggerPanelRedrawArea(PanelId, AID_LM_DEDA_LIGHTS);
+	}
 	imu.Timestep(simdt);								// Do work
 	tcdu.Timestep(simdt);
 	scdu.Timestep(simdt);
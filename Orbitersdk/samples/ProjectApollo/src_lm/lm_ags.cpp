@@ -40,6 +40,7 @@
 #include "LEM.h"
 #include "tracer.h"
 #include "papi.h"
+#include "NamedObjects.h"
 #include "Mission.h"
 
 #include "connector.h"
@@ -228,7 +229,7 @@ void LEM_ASA::Timestep(double simdt){
 VECTOR3 LEM_ASA::GetGravityVector()
 {
 	OBJHANDLE gravref = lem->GetGravityRef();
-	OBJHANDLE hSun = oapiGetObjectByName("Sun");
+	OBJHANDLE hSun = NamedObjects::Sun();
 	VECTOR3 R, U_R;
 	lem->GetRelativePos(gravref, R);
 	U_R = unit(R);
@@ -281,9 +282,9 @@ VECTOR3 LEM_ASA::GetGravityVector()
 	a_dP *= mu / pow(r, 2.0);
 	a_dP -= U_R_S * mu_S / pow(r_S, 2.0);
 
-	if (gravref == oapiGetObjectByName("Moon"))
+	if (gravref == NamedObjects::Moon())
 	{
-		OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+		OBJHANDLE hEarth = NamedObjects::Earth();
 
 		VECTOR3 R_Ea, U_R_E;
 		lem->GetRelativePos(hEarth, R_Ea);
@@ -486,7 +487,7 @@ void LEM_AEA::Timestep(double simt, double simdt) {
 
 	if (!IsPowered()) return;
 
-	int Delta, CycleCount = 0;
+	int Delta, Budget, CycleCount = 0;
 
 	int AsaPulses[6];
 
@@ -498,7 +499,10 @@ void LEM_AEA::Timestep(double simt, double simdt) {
 
 	while (CycleCount < cycles)
 	{
-		Delta = aea_engine(&vags);
+		//Run up to the next ASA cycle or the end of the timestep. The engine also returns
+		//after every INP/OUT instruction, which is the only time the downlink stop discrete can change.
+		Budget = min(cycles - CycleCount, 1024 - ASACycleCounter);
+		Delta = aea_engine_run(&vags, Budget);
 		CycleCount += Delta;
 		ASACycleCounter += Delta;
 
@@ -1111,6 +1115,10 @@ void LEM_AEA::LoadState(FILEHANDLE scn,char *end_str)
 
 LEM_DEDA::LEM_DEDA(LEM *lm, SoundLib &s,LEM_AEA &computer) :  lem(lm), soundlib(s), ags(computer)
 {
+	DisplayVersion = 0;
+	PowerVersion = 0;
+	RedrawVersion = 0;
+	DisplayPower = 0;
 	Reset();
 }
 
@@ -1139,10 +1147,25 @@ void LEM_DEDA::Timestep(double simdt){
 	    soundlib.LoadSound(Sclick, BUTTON_SOUND);
 	}
 
-	if (!IsPowered()) { return; }
+	//
+	// Address and data are updated when the shift register changes, only
+	// the power of the displays has to be checked here.
+	//
 
-	SetAddress();
-	SetData();
+	int power = (IsPowered() ? 1 : 0) | (HasNumPower() ? 2 : 0) | (HasAnnunPower() ? 4 : 0);
+	if (power != DisplayPower) {
+		DisplayPower = power;
+		DisplayVersion++;
+	}
+}
+
+bool LEM_DEDA::CheckRedraw()
+{
+	if (RedrawVersion == DisplayVersion)
+		return false;
+
+	RedrawVersion = DisplayVersion;
+	return true;
 }
 
 void LEM_DEDA::ProcessChannel27(int val)
@@ -1153,6 +1176,7 @@ void LEM_DEDA::ProcessChannel27(int val)
 	}
 	ShiftRegister[State] = (val >> 13) & 017;
 	State++;
+	UpdateDisplay();
 
 	lem->aea.ResetDEDAShiftOut();
 }
@@ -1178,6 +1202,7 @@ void LEM_DEDA::ProcessChannel40(AGSChannelValue40 val)
 			{
 				State--;
 			}
+			UpdateDisplay();
 		}
 		lem->aea.ResetDEDAShiftIn();
 	}
@@ -1202,6 +1227,7 @@ void LEM_DEDA::LoadState(FILEHANDLE scn,char *end_str){
 		papiReadScenario_intarr(line, "SHIFTREGISTER", ShiftRegister, 9);
 		papiReadScenario_int(line, "STATE", State);
 	}
+	UpdateDisplay();
 }
 
 bool LEM_DEDA::IsPowered()
@@ -1255,6 +1281,7 @@ void LEM_DEDA::Reset()
 	{
 		ShiftRegister[i] = 017;
 	}
+	UpdateDisplay();
 }
 
 void LEM_DEDA::ResetKeyDown() 
@@ -1303,15 +1330,19 @@ void LEM_DEDA::SystemTimestep(double simdt)
 	// Check the lights.
 	//
 
-	SegmentsLit = 0;
-	LightsLit = 0;
-	if (OprErrLit()) LightsLit++;
-	//
-	// Check the segments
-	//
+	if (PowerVersion != DisplayVersion) {
+		PowerVersion = DisplayVersion;
+
+		SegmentsLit = 0;
+		LightsLit = 0;
+		if (OprErrLit()) LightsLit++;
+		//
+		// Check the segments
+		//
 
-	SegmentsLit += ThreeDigitDisplaySegmentsLit(Adr);
-	SegmentsLit += SixDigitDisplaySegmentsLit(Data);
+		SegmentsLit += ThreeDigitDisplaySegmentsLit(Adr);
+		SegmentsLit += SixDigitDisplaySegmentsLit(Data);
+	}
 
 	// 10 lights with together max. 6W, 184 segments with together max. 4W  
 	DrawPower((LightsLit * 0.6) + (SegmentsLit * 0.022));
@@ -1672,6 +1703,7 @@ void LEM_DEDA::PlusPressed()
 	if (State == 3){
 		ShiftRegister[State] = 0;
 		State++;
+		UpdateDisplay();
 	} else 
 		SetOprErr(true);
 }
@@ -1683,6 +1715,7 @@ void LEM_DEDA::MinusPressed()
 	if (State == 3){
 		ShiftRegister[State] = 1;
 		State++;
+		UpdateDisplay();
 	} else 
 		SetOprErr(true);
 }
@@ -1721,6 +1754,7 @@ void LEM_DEDA::NumberPressed(int n)
 			}
 			ShiftRegister[State] = n;
 			State++;
+			UpdateDisplay();
 			return;
 		case 3:
 			SetOprErr(true);
@@ -1732,6 +1766,7 @@ void LEM_DEDA::NumberPressed(int n)
 		case 8:
 			ShiftRegister[State] = n;
 			State++;
+			UpdateDisplay();
 			return;
 		case 9:
 			SetOprErr(true);
@@ -1965,6 +2000,13 @@ void LEM_DEDA::SetData()
 	}
 }
 
+void LEM_DEDA::UpdateDisplay()
+{
+	SetAddress();
+	SetData();
+	DisplayVersion++;
+}
+
 char LEM_DEDA::ValueCharSign(unsigned val)
 {
 	switch (val) {
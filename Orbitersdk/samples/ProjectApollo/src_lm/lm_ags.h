@@ -224,8 +224,8 @@ public:
 	// Set light status.
 	//
 
-	void SetOprErr(bool val)		{ OprErrLight = val; };
-	void ClearOprErr()		{ OprErrLight = false; };
+	void SetOprErr(bool val)		{ if (OprErrLight != val) { OprErrLight = val; DisplayVersion++; } };
+	void ClearOprErr()		{ SetOprErr(false); };
 	//
 	// Timestep to run programs.
 	//
@@ -233,6 +233,13 @@ public:
 	void Timestep(double simt);
 	void SystemTimestep(double simdt);
 
+	//
+	// Returns true once after the displayed address, data or OPR ERR light or the
+	// power of the displays changed, so the panel areas only need to be redrawn then.
+	//
+
+	bool CheckRedraw();
+
 	void ProcessChannel27(int val);
 	void ProcessChannel40(AGSChannelValue40 val);
 
@@ -291,8 +298,8 @@ protected:
 	// Lights.
 	//
 
-	void LightOprErrLight()		{ OprErrLight = true; };
-	void ClearOprErrLight()		{ OprErrLight = false; };
+	void LightOprErrLight()		{ SetOprErr(true); };
+	void ClearOprErrLight()		{ SetOprErr(false); };
 
 	//
 	// Light power consumption.
@@ -301,6 +308,16 @@ protected:
 	int LightsLit;
 	int SegmentsLit;
 
+	//
+	// Display change tracking, see DSKY. DisplayPower holds the last
+	// power state of the DEDA, numerics and annunciator as bits.
+	//
+
+	unsigned DisplayVersion;
+	unsigned PowerVersion;
+	unsigned RedrawVersion;
+	int DisplayPower;
+
 	//
 	// Lights state.
 	//
@@ -362,6 +379,7 @@ protected:
 
 	void SetAddress();
 	void SetData();
+	void UpdateDisplay();
 	char ValueChar(unsigned val);
 	char ValueCharSign(unsigned val);
 	void SendKeyCode(int val);
@@ -40,6 +40,7 @@
 #include "LEM.h"
 #include "tracer.h"
 #include "papi.h"
+#include "NamedObjects.h"
 
 #include "saturn.h"
 
@@ -47,6 +48,9 @@
 #include "lm_channels.h"
 #include "LM_AscentStageResource.h"
 
+// Bit rate of the fast MCC uplink
+#define MCC_UPLINK_BIT_RATE 2000.0
+
 // VHF System (and shared stuff)
 LM_VHF::LM_VHF(){
 	lem = NULL;
@@ -57,6 +61,7 @@ LM_VHF::LM_VHF(){
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
 	mcc_size = 0; mcc_offset = 0;
+	mcc_fast = false; mcc_credit = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = 0;
@@ -91,6 +96,7 @@ void LM_VHF::Init(LEM *vessel, h_HeatLoad *vhfh, h_HeatLoad *secvhfh, h_HeatLoad
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
 	mcc_size = 0; mcc_offset = 0;
+	mcc_fast = false; mcc_credit = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = MINUS_INFINITY;
@@ -362,6 +368,10 @@ void LM_VHF::perform_io(double simt){
 		case 1: // INITALIZED, LISTENING
 				// Do we have data from MCC?
 			if (mcc_size > 0) {
+				if (mcc_fast) {
+					fast_mcc_uplink(simt);
+					break;
+				}
 				// sprintf(oapiDebugString(), "MCCSIZE %d LRX %f LRXINT %f", mcc_size, last_rx, ((simt - last_rx) / 0.005));
 				// Should we recieve?
 				if ((fabs(simt - last_rx) / 0.1) < 1 || lem->agc.IsUpruptActive()) {
@@ -518,6 +528,29 @@ void LM_VHF::SaveState(FILEHANDLE scn)
 	oapiWriteScenario_string(scn, "VHFTRANSCEIVER", buffer);
 }
 
+// Feed MCC data at the uplink bit rate. The byte completing a word causes an UPRUPT and the next
+// word waits until the AGC has taken it, so a load needs about one time step per keystroke.
+void LM_VHF::fast_mcc_uplink(double simt) {
+	// No bursts after waiting for the AGC, at most one word (3 bytes) at once
+	mcc_credit += fabs(simt - last_rx) * MCC_UPLINK_BIT_RATE / 8.0;
+	if (mcc_credit > 3.0) { mcc_credit = 3.0; }
+	last_rx = simt;
+
+	while (mcc_size > 0 && mcc_credit >= 1.0 && !lem->agc.IsUpruptActive()) {
+		mcc_credit -= 1.0;
+		rx_data[rx_offset] = mcc_data[mcc_offset];
+		mcc_offset++;
+		// If uplink isn't blocked
+		if (lem->Panel12UpdataLinkSwitch.GetState() == THREEPOSSWITCH_DOWN) {
+			handle_uplink();
+		}
+		// Are we done?
+		if (mcc_offset >= mcc_size) {
+			mcc_offset = mcc_size = 0;
+		}
+	}
+}
+
 // Handle data moved to buffer from either the socket or mcc buffer
 void LM_VHF::handle_uplink()
 {
@@ -2818,8 +2851,8 @@ void LM_OMNI::Init(LEM *vessel) {
 	double beamwidth = 45 * RAD;
 	hpbw_factor = acos(sqrt(sqrt(0.5))) / (beamwidth / 2.0); //Scaling for beamwidth
 
-	hMoon = oapiGetObjectByName("Moon");
-	hEarth = oapiGetObjectByName("Earth");
+	hMoon = NamedObjects::Moon();
+	hEarth = NamedObjects::Earth();
 
 	OMNI_Gain = pow(10, (-3 / 10));
 
@@ -1084,3 +1084,27 @@ aea_engine (ags_t * State)
   Count += MicrosecondsThisInstruction;
   return (MicrosecondsThisInstruction);
 }
+
+//-----------------------------------------------------------------------------
+// Execute instructions until at least Cycles "microseconds" have been used,
+// or until an INP or OUT instruction has been executed, whichever comes first.
+// The caller only needs to look at the i/o ports between calls, rather than
+// after every single instruction as with aea_engine.
+//
+// Returns the number of "microseconds" used.
+
+int
+aea_engine_run (ags_t * State, int Cycles)
+{
+  int Used = 0, OpCode;
+  // At least one instruction is always executed, like aea_engine.
+  do
+    {
+      OpCode = ((State->Memory[State->ProgramCounter] >> 12) & 076);
+      Used += aea_engine (State);
+      if (OpCode == 064 || OpCode == 066)	// INP or OUT?
+        break;
+    }
+  while (Used < Cycles);
+  return (Used);
+}
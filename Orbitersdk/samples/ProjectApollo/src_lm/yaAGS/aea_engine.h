@@ -124,6 +124,7 @@ extern clock_t RealTimeAGS, RealTimeOffsetAGS, LastRealTimeAGS, NextKeycheckAGS;
 // Function prototypes.
 
 int aea_engine (ags_t * State);
+int aea_engine_run (ags_t * State, int Cycles);
 int aea_engine_init (ags_t * State, const char *RomImage, const char *CoreDump);
 void MakeCoreDumpAGS (ags_t * State, const char *CoreDump);
 void ChannelOutputAGS (ags_t * State, int Type, int Data);
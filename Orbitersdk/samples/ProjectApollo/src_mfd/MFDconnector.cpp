@@ -181,6 +181,39 @@ bool MFDConnector::GetFailed(char *n)
 	return false;
 }
 
+PanelSwitchItem *MFDConnector::GetItem(char *n)
+
+{
+	ConnectorMessage cm;
+
+	cm.destination = type;
+	cm.messageType = PanelConnector::MFD_PANEL_GET_ITEM;
+	cm.val1.pValue = n;
+
+	if (SendMessage(cm))
+	{
+		return static_cast<PanelSwitchItem *>(cm.val1.pValue);
+	}
+
+	return NULL;
+}
+
+unsigned MFDConnector::GetItemVersion()
+
+{
+	ConnectorMessage cm;
+
+	cm.destination = type;
+	cm.messageType = PanelConnector::MFD_PANEL_GET_ITEM_VERSION;
+
+	if (SendMessage(cm))
+	{
+		return cm.val1.iValue;
+	}
+
+	return 0;
+}
+
 bool MFDConnector::ChecklistAutocomplete(bool yesno)
 
 {
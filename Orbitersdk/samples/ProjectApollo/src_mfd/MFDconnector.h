@@ -25,6 +25,8 @@
 #if !defined(_PA_MFDCONNECTOR_H)
 #define _PA_MFDCONNECTOR_H
 
+class PanelSwitchItem;
+
 ///
 /// \ingroup Connectors
 /// \brief MFD to panel connector class.
@@ -91,6 +93,22 @@ public:
 	///
 	bool GetFailed(char *n);
 
+	///
+	/// Look up a panel item once, so that it can be used later without its name.
+	///
+	/// \param n Name of panel item.
+	/// \return Item if found, NULL if not (or if the connector isn't connected).
+	///
+	PanelSwitchItem *GetItem(char *n);
+
+	///
+	/// Get the version of the panel items. Items returned by GetItem with an
+	/// older version are no longer part of the panel and must be looked up again.
+	///
+	/// \return Version, 0 if the connector isn't connected.
+	///
+	unsigned GetItemVersion();
+
 	///
 	/// Tell the checklist to Auto-complete checklist items each timestep.
 	///
@@ -23,6 +23,8 @@ static char debugWinsock[100];
 
 static DWORD WINAPI RTCCMFD_Trampoline(LPVOID ptr) {
 	ARCore *core = (ARCore *)ptr;
+	//Iterators in the RTCC processors repeat many conic calculations with identical inputs, often in consecutive calculations
+	OrbMech::ConicCacheScope cache(core->conicCache);
 	return(core->subThread());
 }
 
@@ -1051,6 +1053,9 @@ ARCore::ARCore(VESSEL* v, AR_GCore* gcin)
 	entrynominal = 1;
 	entryrange = 0.0;
 	EntryRTGO = 0.0;
+	DispersionSet.SigmaR = 1000.0*0.3048;
+	DispersionSet.SigmaV = 1.0*0.3048;
+	DispersionSet.SigmaLD = 0.01;
 	FlybyPeriAlt = 0.0;
 	EntryDesiredInclination = 0.0;
 	RTECalcMode = 1;
@@ -1167,6 +1172,7 @@ ARCore::ARCore(VESSEL* v, AR_GCore* gcin)
 
 	subThreadMode = 0;
 	subThreadStatus = 0;
+	conicCache = OrbMech::CreateConicCache();
 
 	LmkLat = 0;
 	LmkLng = 0;
@@ -1400,6 +1406,7 @@ ARCore::ARCore(VESSEL* v, AR_GCore* gcin)
 
 ARCore::~ARCore()
 {
+	OrbMech::DeleteConicCache(conicCache);
 }
 
 void ARCore::MinorCycle(double SimT, double SimDT, double mjd)
@@ -1499,6 +1506,17 @@ void ARCore::EntryUpdateCalc()
 	EntryRTGO = res.RTGO;
 }
 
+void ARCore::EntryDispersionCalc()
+{
+	startSubthread(47);
+}
+
+void ARCore::GetConicCacheStatistics(OrbMech::ConicCacheStatistics &stats)
+{
+	Lock lock(conicCacheMutex);
+	stats = conicCacheStats;
+}
+
 void ARCore::EntryCalc()
 {
 	startSubthread(7);
@@ -2706,7 +2724,10 @@ int ARCore::startSubthread(int fcn) {
 		if (TerminateThread(hThread, exitcode))
 		{
 			subThreadStatus = 0;
-			if (hThread != NULL) { CloseHandle(hThread); }
+			//The thread could have been stopped in the middle of writing a cache entry, start over with an empty cache once it is gone
+			if (hThread != NULL) { WaitForSingleObject(hThread, INFINITE); CloseHandle(hThread); }
+			OrbMech::DeleteConicCache(conicCache);
+			conicCache = OrbMech::CreateConicCache();
 		}
 		return(-1);
 	}
@@ -4836,8 +4857,30 @@ GC->rtcc->AP11LMManeuverPAD(&opt, lmmanpad);
 		Result = 0;
 	}
 	break;
-	case 47: //Spare
+	case 47: //Entry Dispersion Analysis
 	{
+		SV sv0;
+		VECTOR3 REI, VEI;
+		double RCON, dt, MJD_EI;
+
+		sv0 = GC->rtcc->StateVectorCalc(vessel);
+
+		//Same entry interface and entry range function as the splashdown update
+		RCON = OrbMech::R_Earth + 400000.0 * 0.3048;
+		dt = OrbMech::time_radius_integ(sv0.R, sv0.V, sv0.MJD, RCON, -1, sv0.gravref, oapiGetObjectByName("Earth"), REI, VEI);
+		if (abs(length(REI) - RCON) > 1000.0)
+		{
+			//Trajectory doesn't reach entry interface
+			DispersionResults = DispersionLandingStatistics();
+			Result = 0;
+			break;
+		}
+		MJD_EI = sv0.MJD + dt / 24.0 / 3600.0;
+
+		DispersionAnalysis da(GC->rtcc, DispersionSet);
+
+		da.Entry(REI, VEI, MJD_EI, 0.3, 2, entryrange, DispersionResults);
+
 		Result = 0;
 	}
 	break;
@@ -4938,6 +4981,13 @@ GC->rtcc->AP11LMManeuverPAD(&opt, lmmanpad);
 	break;
 	}
 
+	{
+		//The MFD reads the counters on the main thread
+		OrbMech::ConicCacheStatistics stats;
+		OrbMech::GetConicCacheStatistics(stats);
+		Lock lock(conicCacheMutex);
+		conicCacheStats = stats;
+	}
 	subThreadStatus = Result;
 	if (hThread != NULL) { CloseHandle(hThread); }
 
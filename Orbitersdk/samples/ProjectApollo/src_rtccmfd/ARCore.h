@@ -6,6 +6,7 @@
 #include "ApollomfdButtons.h"
 #include "OrbMech.h"
 #include "EntryCalculations.h"
+#include "DispersionAnalysis.h"
 #include "soundlib.h"
 #include "apolloguidance.h"
 #include "dsky.h"
@@ -72,6 +73,8 @@ public:
 	void DeorbitCalc();
 	void TLCCCalc();
 	void EntryUpdateCalc();
+	void EntryDispersionCalc();
+	void GetConicCacheStatistics(OrbMech::ConicCacheStatistics &stats);
 	void StateVectorCalc();
 	void AGSStateVectorCalc();
 	void LandingSiteUpdate();
@@ -153,6 +156,9 @@ public:
 	HANDLE hThread;
 	int subThreadMode;										// What should the subthread do?
 	int subThreadStatus;									// 0 = done/not busy, 1 = busy, negative = done with error
+	OrbMech::ConicCache *conicCache;						// Conic result cache of the subthread, kept from one calculation to the next
+	OrbMech::ConicCacheStatistics conicCacheStats;			// Cache counters as of the end of the last calculation, guarded by conicCacheMutex
+	Mutex conicCacheMutex;
 
 	ApolloRTCCMFDData g_Data;
 
@@ -302,6 +308,10 @@ public:
 	int entrypadopt; //0 = Earth Entry Update, 1 = Lunar Entry
 	double EntryRTGO;
 
+	//ENTRY DISPERSION PAGE
+	DispersionSettings DispersionSet;
+	DispersionLandingStatistics DispersionResults;
+
 	//MAP UPDATE PAGE
 	AP10MAPUPDATE mapupdate;
 	double GSAOSGET, GSLOSGET;
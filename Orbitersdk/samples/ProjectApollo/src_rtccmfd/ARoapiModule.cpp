@@ -28,6 +28,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "Orbitersdk.h"
 #include "ApolloRTCCMFD.h"
 #include "ARoapiModule.h"
+#include "VesselStates.h"
 
 //
 // ==============================================================
@@ -98,6 +99,7 @@ void ARoapiModule::clbkSimulationEnd() {                                      //
 		delete g_SC;
 		g_SC = 0;
 	}
+	VesselStates::Clear();
 	return;
 }
 void ARoapiModule::clbkPreStep(double simt, double simdt, double mjd) {      // Called on each iteration of the calc engine (more often than the MFD Update
@@ -107,10 +109,21 @@ void ARoapiModule::clbkPreStep(double simt, double simdt, double mjd) {      //
 	return;
 }
 
-void ARoapiModule::clbkPostStep(double simt, double simdt, double mjd) {}
+void ARoapiModule::clbkPostStep(double simt, double simdt, double mjd) {      // States at the end of the step, for the calculation threads
+	// Only vessels that still exist, a target or CSM/LM pointer can outlive its vessel
+	for (DWORD i = 0;i<oapiGetVesselCount();i++) {
+		VESSEL *v = oapiGetVesselInterface(oapiGetVesselByIndex(i));
+		bool used = g_SC && (v == g_SC->pCSM || v == g_SC->pLM);
+		for (int j = 0;j<nGutsUsed && !used;j++) {
+			used = (v == GCoreData[j]->vessel || v == GCoreData[j]->target);
+		}
+		if (used) VesselStates::Publish(v);
+	}
+}
 
 void ARoapiModule::clbkDeleteVessel(OBJHANDLE hVessel) {                     // Tidy up when a vessel is deleted (stops clbkPreStep calling a dead vessel)
 	VESSEL *vessel = oapiGetVesselInterface(hVessel);
+	VesselStates::Remove(vessel);
 	for (int i = 0;i<nGutsUsed;i++) {
 		if (GCoreVessel[i] == vessel) {
 			delete GCoreData[i];
@@ -20,6 +20,7 @@
 #include "iu.h"
 #include "ARoapiModule.h"
 #include "TLMCC.h"
+#include "RTCCSnapshot.h"
 
 // ==============================================================
 // Global variables
@@ -31,6 +32,7 @@ VESSEL *GCoreVessel[32];
 AR_GCore *g_SC = NULL;      // points to the static core, root of all persistence
 int nGutsUsed;
 bool initialised = false;
+std::string LastSnapshot; // RTCC table snapshot written by the last save
 
 // ==============================================================
 // MFD class implementation
@@ -124,18 +126,35 @@ void ApolloRTCCMFD::WriteStatus(FILEHANDLE scn) const
 	oapiWriteScenario_int(scn, "VESSELTYPE", G->vesseltype);
 	papiWriteScenario_double(scn, "SXTSTARDTIME", G->sxtstardtime);
 
-	for (i = 0;i < 12;i++)
+	//Ephemeris, mission plan, REFSMMAT and station contact tables
+	std::string snapshot = RTCCSnapshot::FileName(oapiGetSimMJD());
+	CreateDirectory(".\\Config\\ProjectApollo\\RTCC", NULL);
+	if (RTCCSnapshot::Save(GC->rtcc, snapshot.c_str()))
 	{
-		if (GC->rtcc->EZJGMTX1.data[i].ID > 0)
+		strcpy(Buffer2, snapshot.c_str());
+		oapiWriteScenario_string(scn, "RTCC_SNAPSHOT", Buffer2);
+		//Every MFD saves the same tables, only look for unused snapshot files once per save
+		if (LastSnapshot != snapshot)
 		{
-			papiWriteScenario_REFS(scn, "REFSMMAT", 1, i, GC->rtcc->EZJGMTX1.data[i]);
+			RTCCSnapshot::DeleteUnreferenced(snapshot.c_str());
+			LastSnapshot = snapshot;
 		}
 	}
-	for (i = 0;i < 12;i++)
+	else
 	{
-		if (GC->rtcc->EZJGMTX3.data[i].ID > 0)
+		for (i = 0;i < 12;i++)
 		{
-			papiWriteScenario_REFS(scn, "REFSMMAT", 3, i, GC->rtcc->EZJGMTX3.data[i]);
+			if (GC->rtcc->EZJGMTX1.data[i].ID > 0)
+			{
+				papiWriteScenario_REFS(scn, "REFSMMAT", 1, i, GC->rtcc->EZJGMTX1.data[i]);
+			}
+		}
+		for (i = 0;i < 12;i++)
+		{
+			if (GC->rtcc->EZJGMTX3.data[i].ID > 0)
+			{
+				papiWriteScenario_REFS(scn, "REFSMMAT", 3, i, GC->rtcc->EZJGMTX3.data[i]);
+			}
 		}
 	}
 
@@ -342,6 +361,11 @@ void ApolloRTCCMFD::ReadStatus(FILEHANDLE scn)
 				GC->rtcc->EZJGMTX3.data[inttemp2] = refs;
 			}
 		}
+		if (papiReadScenario_string(line, "RTCC_SNAPSHOT", Buffer2))
+		{
+			//Missing or outdated snapshots are ignored, the tables are then rebuilt as before
+			RTCCSnapshot::Load(GC->rtcc, Buffer2);
+		}
 
 		papiReadScenario_int(line, "REFSMMATcur", G->REFSMMATcur);
 		papiReadScenario_int(line, "REFSMMATopt", G->REFSMMATopt);
@@ -1483,6 +1507,12 @@ void ApolloRTCCMFD::menuSetGuidanceOpticsSupportTablePage()
 	coreButtons.SelectPage(this, screen);
 }
 
+void ApolloRTCCMFD::menuSetEntryDispersionPage()
+{
+	screen = 96;
+	coreButtons.SelectPage(this, screen);
+}
+
 void ApolloRTCCMFD::menuVoid() {}
 
 void ApolloRTCCMFD::menuCycleRTETradeoffPage()
@@ -4187,6 +4217,58 @@ void ApolloRTCCMFD::GeneralMEDRequest(char *str)
 	G->GeneralMEDRequest();
 }
 
+void ApolloRTCCMFD::menuEntryDispersionCalc()
+{
+	G->EntryDispersionCalc();
+}
+
+void ApolloRTCCMFD::menuSetDispersionCases()
+{
+	bool DispersionCasesInput(void* id, char *str, void *data);
+	oapiOpenInputBox("Dispersion cases. Format: Cases Threads (0 = one per processor)", DispersionCasesInput, 0, 20, (void*)this);
+}
+
+bool DispersionCasesInput(void* id, char *str, void *data)
+{
+	unsigned cases, threads = 0;
+	if (sscanf(str, "%u %u", &cases, &threads) >= 1 && cases > 0)
+	{
+		((ApolloRTCCMFD*)data)->set_DispersionCases(cases, threads);
+		return true;
+	}
+	return false;
+}
+
+void ApolloRTCCMFD::set_DispersionCases(unsigned cases, unsigned threads)
+{
+	G->DispersionSet.NumCases = cases;
+	G->DispersionSet.NumThreads = threads;
+}
+
+void ApolloRTCCMFD::menuSetDispersionSigmas()
+{
+	bool DispersionSigmasInput(void* id, char *str, void *data);
+	oapiOpenInputBox("1-sigma errors at entry interface. Format: Position (ft) Velocity (ft/s) L/D", DispersionSigmasInput, 0, 30, (void*)this);
+}
+
+bool DispersionSigmasInput(void* id, char *str, void *data)
+{
+	double sigr, sigv, sigld;
+	if (sscanf(str, "%lf %lf %lf", &sigr, &sigv, &sigld) == 3 && sigr >= 0.0 && sigv >= 0.0 && sigld >= 0.0)
+	{
+		((ApolloRTCCMFD*)data)->set_DispersionSigmas(sigr, sigv, sigld);
+		return true;
+	}
+	return false;
+}
+
+void ApolloRTCCMFD::set_DispersionSigmas(double sigr, double sigv, double sigld)
+{
+	G->DispersionSet.SigmaR = sigr * 0.3048;
+	G->DispersionSet.SigmaV = sigv * 0.3048;
+	G->DispersionSet.SigmaLD = sigld;
+}
+
 void ApolloRTCCMFD::EntryRangeDialogue()
 {
 	bool EntryRangeInput(void *id, char *str, void *data);
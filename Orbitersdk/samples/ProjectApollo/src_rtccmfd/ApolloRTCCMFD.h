@@ -23,6 +23,7 @@
 #include "saturn.h"
 #include "saturnv.h"
 #include "LEM.h"
+#include "RetainedDisplay.h"
 
 class ApolloRTCCMFD: public MFD2 {
 public:
@@ -138,6 +139,11 @@ public:
 	void set_RTEManeuverCode(char *code);
 	void menuEntryCalc();
 	void menuEntryUpdateCalc();
+	void menuEntryDispersionCalc();
+	void menuSetDispersionCases();
+	void set_DispersionCases(unsigned cases, unsigned threads);
+	void menuSetDispersionSigmas();
+	void set_DispersionSigmas(double sigr, double sigv, double sigld);
 	void menuDeorbitCalc();
 	void menuMoonRTECalc();
 	void menuTransferRTEToMPT();
@@ -295,6 +301,7 @@ public:
 	void menuSetMoonEntryPage();
 	void menuSetRTEConstraintsPage();
 	void menuSetEntryUpdatePage();
+	void menuSetEntryDispersionPage();
 	void menuSetP37PADPage();
 	void menuSetRendezvousPage();
 	void menuSetDKIPage();
@@ -705,6 +712,12 @@ public:
 	void menuGOSTShowLandmarkVector();
 
 protected:
+	//Table display pages, drawn into the retained display and only formatted again when the table changes
+	void DrawFIDOOrbitDigitals(RetainedDisplay *skp);
+	void DrawSpaceDigitals(RetainedDisplay *skp);
+	void DrawMissionPlanTable(RetainedDisplay *skp);
+	void DrawNextStationContacts(RetainedDisplay *skp);
+
 	oapi::Font *font;
 	oapi::Font *font2;
 	oapi::Font *font2vert;
@@ -717,6 +730,7 @@ protected:
 	int screen;
 	int marker;
 	int RTETradeoffScreen;
+	RetainedDisplay retained;
 	static struct ScreenData {
 		int screen;
 		int RTETradeoffScreen;
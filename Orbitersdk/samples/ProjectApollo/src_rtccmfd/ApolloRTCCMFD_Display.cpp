@@ -879,6 +879,25 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		//skp->Text(1 * W / 8, 12 * H / 14, "DV Format:", 9);
 		//skp->Text(5 * W / 8, 12 * H / 14, "AGC DSKY", 8);
+
+		//Conic cache of the calculation thread, counters of all calculations since the cache was created
+		if (G->subThreadStatus < 1)
+		{
+			OrbMech::ConicCacheStatistics stats;
+			unsigned long long hits = 0, calls = 0;
+			G->GetConicCacheStatistics(stats);
+			for (int i = 0;i < OrbMech::CONIC_CACHE_NUM;i++)
+			{
+				hits += stats.Hits[i];
+				calls += stats.Hits[i] + stats.Misses[i];
+			}
+			skp->Text(1 * W / 8, 13 * H / 14, "Conic Cache:", 12);
+			if (calls > 0)
+			{
+				sprintf(Buffer, "%.0f%% of %llu", 100.0*(double)hits / (double)calls, calls);
+				skp->Text(4 * W / 8, 13 * H / 14, Buffer, strlen(Buffer));
+			}
+		}
 	}
 	else if (screen == 9)
 	{
@@ -3284,256 +3303,20 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	}
 	else if (screen == 41 || screen == 71)
 	{
-		FIDOOrbitDigitals *tab;
-
 		if (screen == 41)
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 1 (MSK 0046)", 18);
-			tab = &GC->rtcc->EZSAVCSM;
 			G->CycleFIDOOrbitDigitals1();
 		}
 		else
 		{
-			skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 2 (MSK 0045)", 18);
-			tab = &GC->rtcc->EZSAVLEM;
 			G->CycleFIDOOrbitDigitals2();
 		}
 
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		skp->Text(5 * W / 32, 3 * H / 28, "GET", 3);
-		skp->Text(5 * W / 32, 4 * H / 28, "VEHICLE", 7);
-		skp->Text(5 * W / 32, 5 * H / 28, "REV", 3);
-		skp->Text(5 * W / 32, 6 * H / 28, "REF", 3);
-		skp->Text(5 * W / 32, 7 * H / 28, "GMT ID", 6);
-		skp->Text(5 * W / 32, 8 * H / 28, "GET ID", 6);
-		skp->Text(5 * W / 32, 10 * H / 28, "H", 1);
-		skp->Text(5 * W / 32, 11 * H / 28, "V", 1);
-		skp->Text(5 * W / 32, 12 * H / 28, "GAM", 3);
-		skp->Text(5 * W / 32, 14 * H / 28, "A", 1);
-		skp->Text(5 * W / 32, 15 * H / 28, "E", 1);
-		skp->Text(5 * W / 32, 16 * H / 28, "I", 1);
-		skp->Text(5 * W / 32, 18 * H / 28, "HA", 2);
-		skp->Text(5 * W / 32, 19 * H / 28, "PA", 2);
-		skp->Text(5 * W / 32, 20 * H / 28, "LA", 2);
-		skp->Text(5 * W / 32, 21 * H / 28, "GETA", 4);
-		skp->Text(5 * W / 32, 23 * H / 28, "HP", 2);
-		skp->Text(5 * W / 32, 24 * H / 28, "PP", 2);
-		skp->Text(5 * W / 32, 25 * H / 28, "LP", 2);
-		skp->Text(5 * W / 32, 26 * H / 28, "GETP", 4);
-
-		skp->Text(15 * W / 32, 3 * H / 28, "LPP", 3);
-		skp->Text(15 * W / 32, 4 * H / 28, "PPP", 3);
-		skp->Text(15 * W / 32, 5 * H / 28, "GETCC", 5);
-		skp->Text(15 * W / 32, 6 * H / 28, "TAPP", 4);
-		skp->Text(15 * W / 32, 7 * H / 28, "LNPP", 4);
-
-		skp->Text(25 * W / 32, 3 * H / 28, "REVL", 4);
-		skp->Text(25 * W / 32, 4 * H / 28, "GETL", 4);
-		skp->Text(25 * W / 32, 5 * H / 28, "L", 1);
-		skp->Text(25 * W / 32, 6 * H / 28, "TO", 2);
-		skp->Text(25 * W / 32, 7 * H / 28, "K", 1);
-		skp->Text(25 * W / 32, 8 * H / 28, "ORBWT", 5);
-
-		skp->Text(25 * W / 32, 10 * H / 28, "REQUESTED", 9);
-		skp->Text(23 * W / 32, 11 * H / 28, "REF", 3);
-		skp->Text(23 * W / 32, 12 * H / 28, "GETBV", 5);
-		skp->Text(23 * W / 32, 13 * H / 28, "HA", 2);
-		skp->Text(23 * W / 32, 14 * H / 28, "PA", 2);
-		skp->Text(23 * W / 32, 15 * H / 28, "LA", 2);
-		skp->Text(23 * W / 32, 16 * H / 28, "GETA", 4);
-		skp->Text(23 * W / 32, 18 * H / 28, "HP", 2);
-		skp->Text(23 * W / 32, 19 * H / 28, "PP", 2);
-		skp->Text(23 * W / 32, 20 * H / 28, "LP", 2);
-		skp->Text(23 * W / 32, 21 * H / 28, "GETP", 4);
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		GET_Display(Buffer, tab->GET, false);
-		skp->Text(3 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, tab->VEHID);
-		skp->Text(3 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%03d", tab->REV);
-		skp->Text(3 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, tab->REF);
-		skp->Text(3 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GMTID, false);
-		skp->Text(3 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETID, false);
-		skp->Text(3 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->H);
-		skp->Text(3 * W / 16, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", tab->V);
-		skp->Text(3 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.2f", tab->GAM);
-		skp->Text(3 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->A);
-		skp->Text(3 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.4f", tab->E);
-		skp->Text(3 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", tab->I);
-		skp->Text(3 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
-
-		if (tab->E < 1.0)
-		{
-			sprintf(Buffer, "%08.1f", tab->HA);
-			skp->Text(3 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
-			if (tab->E > 0.0001)
-			{
-				if (tab->PA > 0)
-				{
-					sprintf(Buffer, "%06.2f N", tab->PA);
-				}
-				else
-				{
-					sprintf(Buffer, "%06.2f S", abs(tab->PA));
-				}
-				skp->Text(3 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
-				if (tab->LA > 0)
-				{
-					sprintf(Buffer, "%06.2f E", tab->LA);
-				}
-				else
-				{
-					sprintf(Buffer, "%06.2f W", abs(tab->LA));
-				}
-				skp->Text(3 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
-				GET_Display(Buffer, tab->GETA, false);
-				skp->Text(3 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
-			}
-		}
-
-		sprintf(Buffer, "%08.1f", tab->HP);
-		skp->Text(3 * W / 16, 23 * H / 28, Buffer, strlen(Buffer));
-		if (tab->E > 0.0001)
-		{
-			if (tab->PP > 0)
-			{
-				sprintf(Buffer, "%06.2f N", tab->PP);
-			}
-			else
-			{
-				sprintf(Buffer, "%06.2f S", abs(tab->PP));
-			}
-			skp->Text(3 * W / 16, 24 * H / 28, Buffer, strlen(Buffer));
-			if (tab->LP > 0)
-			{
-				sprintf(Buffer, "%06.2f E", tab->LP);
-			}
-			else
-			{
-				sprintf(Buffer, "%06.2f W", abs(tab->LP));
-			}
-			skp->Text(3 * W / 16, 25 * H / 28, Buffer, strlen(Buffer));
-			GET_Display(Buffer, tab->GETP, false);
-			skp->Text(3 * W / 16, 26 * H / 28, Buffer, strlen(Buffer));
-		}
-
-		if (tab->LPP > 0)
-		{
-			sprintf(Buffer, "%06.2f E", tab->LPP);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(tab->LPP));
-		}
-		skp->Text(8 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
-		if (tab->PPP > 0)
-		{
-			sprintf(Buffer, "%06.2f N", tab->PPP);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(tab->PPP));
-		}
-		skp->Text(8 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETCC, false);
-		skp->Text(8 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
-		if (tab->E > 0.0001)
-		{
-			sprintf(Buffer, "%05.1f", tab->TAPP);
-			skp->Text(8 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		}
-		if (tab->LNPP > 0)
-		{
-			sprintf(Buffer, "%06.2f E", tab->LNPP);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(tab->LNPP));
-		}
-		skp->Text(8 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%04d", tab->REVL);
-		skp->Text(13 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETL, false);
-		skp->Text(13 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
-		if (tab->L > 0)
-		{
-			sprintf(Buffer, "%06.2f E", tab->L);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(tab->L));
-		}
-		skp->Text(13 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->TO, false);
-		skp->Text(13 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.1f", tab->K);
-		skp->Text(13 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%07.1f", tab->ORBWT);
-		skp->Text(13 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, tab->REFR);
-		skp->Text(12 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETBV, false);
-		skp->Text(12 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", tab->HAR);
-		skp->Text(12 * W / 16, 13 * H / 28, Buffer, strlen(Buffer));
-		if (tab->PAR > 0)
-		{
-			sprintf(Buffer, "%06.2f N", tab->PAR);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(tab->PAR));
-		}
-		skp->Text(12 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
-		if (tab->LAR > 0)
-		{
-			sprintf(Buffer, "%06.2f E", tab->LAR);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(tab->LAR));
-		}
-		skp->Text(12 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETAR, false);
-		skp->Text(12 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%08.1f", tab->HPR);
-		skp->Text(12 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
-		if (tab->PPR > 0)
-		{
-			sprintf(Buffer, "%06.2f N", tab->PPR);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(tab->PPR));
-		}
-		skp->Text(12 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
-		if (tab->LPR > 0)
-		{
-			sprintf(Buffer, "%06.2f E", tab->LPR);
-		}
-		else
+		if (retained.Record(screen, GC->rtcc->DisplayTableVersion.FIDOOrbitDigitals[screen == 41 ? 0 : 1]))
 		{
-			sprintf(Buffer, "%06.2f W", abs(tab->LPR));
+			DrawFIDOOrbitDigitals(&retained);
 		}
-		skp->Text(12 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, tab->GETPR, false);
-		skp->Text(12 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
+		retained.Draw(skp);
 	}
 	else if (screen == 42)
 	{
@@ -3573,470 +3356,29 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 	{
 		G->CycleSpaceDigitals();
 
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		if (GC->rtcc->EZETVMED.SpaceDigVehID == 3)
-		{
-			skp->Text(4 * W / 8, 1 * H / 64, "LEM SPACE DIGITALS", 18);
-		}
-		else
-		{
-			skp->Text(4 * W / 8, 1 * H / 64, "CSM SPACE DIGITALS", 18);
-		}
-
-		skp->SetFont(font2);
-
-		skp->Text(1 * W / 32, 2 * H / 28, "STA ID", 6);
-		skp->Text(1 * W / 32, 3 * H / 28, "GMTV", 4);
-		skp->Text(1 * W / 32, 5 * H / 28, "GET", 3);
-		skp->Text(1 * W / 32, 6 * H / 28, "REF", 3);
-		skp->Text(1 * W / 32, 8 * H / 28, "GET VECTOR 1", 12);
-		skp->Text(1 * W / 32, 10 * H / 28, "REF", 3);
-		skp->Text(11 * W / 64, 10 * H / 28, "WT", 2);
-		skp->Text(1 * W / 32, 11 * H / 28, "AREA", 4);
-		skp->Text(1 * W / 32, 12 * H / 28, "GETA", 4);
-		skp->Text(1 * W / 32, 13 * H / 28, "HA", 2);
-		skp->Text(1 * W / 32, 14 * H / 28, "HP", 2);
-		skp->Text(1 * W / 32, 15 * H / 28, "H", 1);
-		skp->Text(1 * W / 32, 16 * H / 28, "V", 1);
-		skp->Text(1 * W / 32, 17 * H / 28, "GAM", 3);
-		skp->Text(1 * W / 32, 18 * H / 28, "PSI", 3);
-		skp->Text(1 * W / 32, 19 * H / 28, "PHI", 3);
-		skp->Text(1 * W / 32, 20 * H / 28, "LAM", 3);
-		skp->Text(1 * W / 32, 21 * H / 28, "HS", 2);
-		skp->Text(1 * W / 32, 22 * H / 28, "HO", 2);
-		skp->Text(1 * W / 32, 23 * H / 28, "PHIO", 4);
-		skp->Text(1 * W / 32, 24 * H / 28, "IEMP", 4);
-		skp->Text(1 * W / 32, 25 * H / 28, "W", 1);
-		skp->Text(1 * W / 32, 26 * H / 28, "OMG", 3);
-		skp->Text(1 * W / 32, 27 * H / 28, "PRA", 3);
-		skp->Text(8 * W / 32, 24 * H / 28, "A", 1);
-		skp->Text(8 * W / 32, 25 * H / 28, "L", 1);
-		skp->Text(8 * W / 32, 26 * H / 28, "E", 1);
-		skp->Text(8 * W / 32, 27 * H / 28, "I", 1);
-
-		skp->Text(11 * W / 32, 2 * H / 28, "WEIGHT", 6);
-		skp->Text(11 * W / 32, 3 * H / 28, "GETV", 4);
-		skp->Text(11 * W / 32, 8 * H / 28, "GET VECTOR 2", 12);
-		skp->Text(11 * W / 32, 10 * H / 28, "GETSI", 5);
-		skp->Text(11 * W / 32, 11 * H / 28, "GETCA", 5);
-		skp->Text(11 * W / 32, 12 * H / 28, "VCA", 3);
-		skp->Text(11 * W / 32, 13 * H / 28, "HCA", 3);
-		skp->Text(11 * W / 32, 14 * H / 28, "PCA", 3);
-		skp->Text(11 * W / 32, 15 * H / 28, "LCA", 3);
-		skp->Text(11 * W / 32, 16 * H / 28, "PSICA", 5);
-		skp->Text(11 * W / 32, 17 * H / 28, "GETMN", 5);
-		skp->Text(11 * W / 32, 18 * H / 28, "HMN", 3);
-		skp->Text(11 * W / 32, 19 * H / 28, "PMN", 3);
-		skp->Text(11 * W / 32, 20 * H / 28, "LMN", 3);
-		skp->Text(11 * W / 32, 21 * H / 28, "DMN", 3);
-
-		skp->Text(21 * W / 32, 3 * H / 28, "GET AXIS", 8);
-		skp->Text(21 * W / 32, 8 * H / 28, "GET VECTOR 3", 12);
-		skp->Text(21 * W / 32, 10 * H / 28, "GETSE", 5);
-		skp->Text(21 * W / 32, 11 * H / 28, "GETEI", 5);
-		skp->Text(21 * W / 32, 12 * H / 28, "VEI", 3);
-		skp->Text(21 * W / 32, 13 * H / 28, "GEI", 3);
-		skp->Text(21 * W / 32, 14 * H / 28, "PEI", 3);
-		skp->Text(21 * W / 32, 15 * H / 28, "LEI", 3);
-		skp->Text(21 * W / 32, 16 * H / 28, "PSIEI", 5);
-		skp->Text(21 * W / 32, 17 * H / 28, "GETVP", 5);
-		skp->Text(21 * W / 32, 18 * H / 28, "VVP", 3);
-		skp->Text(21 * W / 32, 19 * H / 28, "HVP", 3);
-		skp->Text(21 * W / 32, 20 * H / 28, "PVP", 3);
-		skp->Text(21 * W / 32, 21 * H / 28, "LVP", 3);
-		skp->Text(21 * W / 32, 22 * H / 28, "PSI VP", 6);
-		skp->Text(21 * W / 32, 26 * H / 28, "IE", 2);
-		skp->Text(21 * W / 32, 27 * H / 28, "LN", 2);
-
-		skp->Text(9 * W / 32, 5 * H / 28, "V", 1);
-		skp->Text(13 * W / 32, 5 * H / 28, "PHI", 3);
-		skp->Text(20 * W / 32, 5 * H / 28, "H", 1);
-		skp->Text(25 * W / 32, 5 * H / 28, "ADA", 3);
-
-		skp->Text(8 * W / 32, 6 * H / 28, "GAM", 3);
-		skp->Text(15 * W / 32, 6 * H / 28, "LAM", 3);
-		skp->Text(23 * W / 32, 6 * H / 28, "PSI", 3);
-
-		sprintf_s(Buffer, "%s", GC->rtcc->EZSPACE.errormessage.c_str());
-		skp->Text(14 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GMTV, false);
-		skp->Text(4 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GET, false);
-		skp->Text(4 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, GC->rtcc->EZSPACE.REF);
-		skp->Text(4 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%07.1f", GC->rtcc->EZSPACE.WEIGHT);
-		skp->Text(16 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETV, false);
-		skp->Text(14 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETR, false);
-		skp->Text(26 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V);
-		skp->Text(10 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PHI > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI));
-		}
-		skp->Text(15 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.H);
-		skp->Text(21 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.ADA);
-		skp->Text(28 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM);
-		skp->Text(11 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LAM > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM);
-		}
-		else
+		if (retained.Record(screen, GC->rtcc->DisplayTableVersion.SpaceDigitals, GC->rtcc->EZETVMED.SpaceDigVehID))
 		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM));
+			DrawSpaceDigitals(&retained);
 		}
-		skp->Text(18 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI);
-		skp->Text(25 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector1, false);
-		skp->Text(1 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector2, false);
-		skp->Text(11 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector3, false);
-		skp->Text(21 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		skp->Text(25 * W / 32, 2 * H / 28, "GETR", 4);
-
-		sprintf(Buffer, GC->rtcc->EZSPACE.REF1);
-		skp->Text(10 * W / 64, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.WT);
-		skp->Text(10 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HA);
-		skp->Text(10 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HP);
-		skp->Text(10 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.H1);
-		skp->Text(10 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V1);
-		skp->Text(10 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM1);
-		skp->Text(10 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI1);
-		skp->Text(10 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PHI1 > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI1);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI1));
-		}
-		skp->Text(10 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LAM1 > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM1);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM1));
-		}
-		skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HS);
-		skp->Text(10 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HO);
-		skp->Text(10 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PHIO > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHIO);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHIO));
-		}
-		skp->Text(10 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IEMP);
-		skp->Text(7 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.W1);
-		skp->Text(7 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.OMG);
-		skp->Text(7 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.PRA);
-		skp->Text(7 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		if (GC->rtcc->EZSPACE.A1 > 0)
-		{
-			sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.A1);
-			skp->Text(13 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
-		}
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.L1);
-		skp->Text(13 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%.5f", GC->rtcc->EZSPACE.E1);
-		skp->Text(13 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.I1);
-		skp->Text(13 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETSI, false);
-		skp->Text(20 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETCA, false);
-		skp->Text(20 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VCA);
-		skp->Text(20 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HCA);
-		skp->Text(20 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PCA > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PCA);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PCA));
-		}
-		skp->Text(20 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LCA > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LCA);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LCA));
-		}
-		skp->Text(20 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSICA);
-		skp->Text(20 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETMN, false);
-		skp->Text(20 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HMN);
-		skp->Text(20 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PMN > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PMN);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PMN));
-		}
-		skp->Text(20 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LMN > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LMN);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LMN));
-		}
-		skp->Text(20 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.DMN);
-		skp->Text(20 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-
-
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETSE, false);
-		skp->Text(30 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETEI, false);
-		skp->Text(30 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VEI);
-		skp->Text(30 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GEI);
-		skp->Text(30 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PEI > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PEI);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PEI));
-		}
-		skp->Text(30 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LEI > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LEI);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LEI));
-		}
-		skp->Text(30 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSIEI);
-		skp->Text(30 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
-		GET_Display(Buffer, GC->rtcc->EZSPACE.GETVP, false);
-		skp->Text(30 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VVP);
-		skp->Text(30 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HVP);
-		skp->Text(30 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.PVP > 0)
-		{
-			sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PVP);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PVP));
-		}
-		skp->Text(30 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
-		if (GC->rtcc->EZSPACE.LVP > 0)
-		{
-			sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LVP);
-		}
-		else
-		{
-			sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LVP));
-		}
-		skp->Text(30 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSIVP);
-		skp->Text(30 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
-
-		sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IE);
-		skp->Text(30 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
-		sprintf(Buffer, "%06.2f", GC->rtcc->EZSPACE.LN);
-		skp->Text(30 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+		retained.Draw(skp);
 	}
 	else if (screen == 44)
 	{
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(4 * W / 8, 1 * H / 14, "MISSION PLAN TABLE (MSK 0047)", 29);
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-		if (GC->MissionPlanningActive)
+		if (retained.Record(screen, GC->rtcc->DisplayTableVersion.MissionPlanTable, GC->MissionPlanningActive))
 		{
-			skp->Text(1 * W / 32, 2 * H / 14, "Active", 6);
+			DrawMissionPlanTable(&retained);
 		}
-		else
-		{
-			skp->Text(1 * W / 32, 2 * H / 14, "Inactive", 8);
-		}
-
-		skp->SetFont(font2);
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-		skp->Text(3 * W / 32, 8 * H / 28, "GETBI", 5);
-		skp->Text(8 * W / 32, 8 * H / 28, "DT", 2);
-		skp->Text(12 * W / 32, 8 * H / 28, "DELTAV", 6);
-		skp->Text(16 * W / 32, 8 * H / 28, "DVREM", 5);
-		skp->Text(20 * W / 32, 8 * H / 28, "HA", 2);
-		skp->Text(47 * W / 64, 8 * H / 28, "HP", 2);
-		skp->Text(29 * W / 32, 8 * H / 28, "CODE", 4);
-
-		skp->SetTextAlign(oapi::Sketchpad::LEFT);
-
-		skp->Text(6 * W / 32, 5 * H / 28, "CSM STA ID", 10);
-		skp->Text(6 * W / 32, 6 * H / 28, "GETAV", 5);
-		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.CSMGETAV.c_str());
-		skp->Text(10 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-		skp->Text(18 * W / 32, 5 * H / 28, "LEM STA ID", 10);
-		skp->Text(18 * W / 32, 6 * H / 28, "GETAV", 5);
-		sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.LEMGETAV.c_str());
-		skp->Text(22 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
-
-		skp->SetTextAlign(oapi::Sketchpad::RIGHT);
-
-		for (unsigned i = 0;i < GC->rtcc->MPTDISPLAY.man.size();i++)
-		{
-			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].GETBI.c_str());
-			skp->Text(5 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-
-			sprintf(Buffer, "%07.1f", GC->rtcc->MPTDISPLAY.man[i].DELTAV);
-			skp->Text(14 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-
-			sprintf(Buffer, "%.1f", GC->rtcc->MPTDISPLAY.man[i].DVREM);
-			skp->Text(18 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-
-			sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HA);
-			skp->Text(43 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-
-			sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HP);
-			skp->Text(50 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-
-			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].code.c_str());
-			skp->Text(63 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
-		}
-
-		for (unsigned i = 1;i < GC->rtcc->MPTDISPLAY.man.size();i++)
-		{
-			sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].DT.c_str());
-			skp->Text(10 * W / 32, (i * 2 + 8) * H / 28, Buffer, strlen(Buffer));
-		}
-
+		retained.Draw(skp);
 	}
 	else if (screen == 45)
 	{
 		G->CycleNextStationContactsDisplay();
 
-		if (GC->rtcc->MGRTAG == 0)
+		if (retained.Record(screen, GC->rtcc->DisplayTableVersion.NextStationContacts, GC->rtcc->MGRTAG))
 		{
-			skp->Text(1 * W / 16, 2 * H / 14, "Lunar", 5);
-		}
-		else
-		{
-			skp->Text(1 * W / 16, 2 * H / 14, "All", 3);
-		}
-
-		skp->SetTextAlign(oapi::Sketchpad::CENTER);
-
-		skp->Text(4 * W / 8, 3 * H / 28, "NEXT STATION CONTACTS (MSK 1503)", 21);
-
-		skp->Text(8 * W / 32, 5 * H / 28, "CSM", 3);
-		skp->Text(24 * W / 32, 5 * H / 28, "LEM", 3);
-
-		skp->SetFont(font2);
-
-		skp->Text(12 * W / 32, 5 * H / 28, "GET", 3);
-
-		skp->Text(2 * W / 32, 17 * H / 56, "STA", 3);
-		skp->Text(6 * W / 32, 8 * H / 28, "GETHCA", 6);
-		skp->Text(6 * W / 32, 9 * H / 28, "DT KLOS", 7);
-		skp->Text(6 * W / 32, 10 * H / 28, "HH MM SS", 8);
-		skp->Text(10 * W / 32, 17 * H / 56, "EMAX", 4);
-		skp->Text(10 * W / 32, 10 * H / 28, "DEG", 4);
-		skp->Text(28 * W / 64, 8 * H / 28, "DTPASS", 6);
-		skp->Text(28 * W / 64, 9 * H / 28, "DT KH", 5);
-		skp->Text(28 * W / 64, 10 * H / 28, "HH MM SS", 8);
-
-		skp->Text(35 * W / 64, 17 * H / 56, "STA", 3);
-		skp->Text(43 * W / 64, 8 * H / 28, "GETHCA", 6);
-		skp->Text(43 * W / 64, 9 * H / 28, "DT KLOS", 7);
-		skp->Text(43 * W / 64, 10 * H / 28, "HH MM SS", 8);
-		skp->Text(51 * W / 64, 17 * H / 56, "EMAX", 4);
-		skp->Text(51 * W / 64, 10 * H / 28, "DEG", 3);
-		skp->Text(59 * W / 64, 8 * H / 28, "DTPASS", 6);
-		skp->Text(59 * W / 64, 9 * H / 28, "DT KH", 5);
-		skp->Text(59 * W / 64, 10 * H / 28, "HH MM SS", 8);
-
-		GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GET, false);
-		skp->Text(16 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
-
-		unsigned i, j;
-		for (j = 0;j < 2;j++)
-		{
-			for (i = 0;i < 6;i++)
-			{
-				sprintf_s(Buffer, GC->rtcc->NextStationContactsBuffer.STA[j][i].c_str());
-				skp->Text((4 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
-
-				if (GC->rtcc->NextStationContactsBuffer.BestAvailableAOS[j][i])
-				{
-					skp->Text((7 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
-				}
-				GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GETHCA[j][i], false);
-				skp->Text((12 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
-
-				if (GC->rtcc->NextStationContactsBuffer.BestAvailableEMAX[j][i])
-				{
-					skp->Text((17 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
-				}
-				sprintf_s(Buffer, "%.1f", GC->rtcc->NextStationContactsBuffer.EMAX[j][i]);
-				skp->Text((20 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
-
-				GET_Display4(Buffer, GC->rtcc->NextStationContactsBuffer.DTPASS[j][i]);
-				skp->Text((27 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
-			}
+			DrawNextStationContacts(&retained);
 		}
+		retained.Draw(skp);
 	}
 	else if (screen == 46 || screen == 72 || screen == 73 || screen == 74)
 	{
@@ -8295,5 +7637,771 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 		sprintf_s(Buffer, "%+.7lf", GC->rtcc->GOSTDisplayBuffer.data.REFSMMAT.m33);
 		skp->Text(42 * W / 43, 24 * H / 26, Buffer, strlen(Buffer));
 	}
+	else if (screen == 96)
+	{
+		skp->Text(5 * W / 8, (int)(0.5 * H / 14), "Entry Dispersions", 17);
+
+		if (G->DispersionSet.NumThreads == 0)
+		{
+			sprintf(Buffer, "%u cases, auto threads", G->DispersionSet.NumCases);
+		}
+		else
+		{
+			sprintf(Buffer, "%u cases, %u threads", G->DispersionSet.NumCases, G->DispersionSet.NumThreads);
+		}
+		skp->Text(1 * W / 8, 2 * H / 14, Buffer, strlen(Buffer));
+		sprintf(Buffer, "Pos %.0f ft, Vel %.1f ft/s", G->DispersionSet.SigmaR / 0.3048, G->DispersionSet.SigmaV / 0.3048);
+		skp->Text(1 * W / 8, 4 * H / 14, Buffer, strlen(Buffer));
+		sprintf(Buffer, "L/D %.3f", G->DispersionSet.SigmaLD);
+		skp->Text(1 * W / 8, 5 * H / 14, Buffer, strlen(Buffer));
+
+		if (G->subThreadStatus > 0)
+		{
+			skp->Text(5 * W / 8, 2 * H / 14, "Calculating...", 14);
+		}
+		else if (G->DispersionResults.NumValid > 0)
+		{
+			sprintf(Buffer, "Lat:  %f ", G->DispersionResults.lat*DEG);
+			skp->Text(4 * W / 8, 7 * H / 14, Buffer, strlen(Buffer));
+			sprintf(Buffer, "Long: %f ", G->DispersionResults.lng*DEG);
+			skp->Text(4 * W / 8, 8 * H / 14, Buffer, strlen(Buffer));
+			sprintf(Buffer, "1-Sigma: %.1f x %.1f NM", G->DispersionResults.SigmaMajor, G->DispersionResults.SigmaMinor);
+			skp->Text(4 * W / 8, 9 * H / 14, Buffer, strlen(Buffer));
+			sprintf(Buffer, "Major Axis Az: %.0f ", G->DispersionResults.AzMajor*DEG);
+			skp->Text(4 * W / 8, 10 * H / 14, Buffer, strlen(Buffer));
+			GET_Display(Buffer, (G->DispersionResults.MJD_L.Mean - GC->rtcc->CalcGETBase())*24.0*3600.0);
+			sprintf(Buffer, "%s +/- %.0f s", Buffer, G->DispersionResults.MJD_L.Sigma*24.0*3600.0);
+			skp->Text(4 * W / 8, 11 * H / 14, Buffer, strlen(Buffer));
+
+			//Throughput of the last analysis
+			sprintf(Buffer, "%u cases in %.2f s", G->DispersionResults.NumValid, G->DispersionResults.RunTime);
+			skp->Text(4 * W / 8, 12 * H / 14, Buffer, strlen(Buffer));
+			if (G->DispersionResults.RunTime > 0.0)
+			{
+				sprintf(Buffer, "%.0f cases/s", (double)G->DispersionResults.NumValid / G->DispersionResults.RunTime);
+				skp->Text(4 * W / 8, 13 * H / 14, Buffer, strlen(Buffer));
+			}
+		}
+	}
 	return true;
+}
+
+void ApolloRTCCMFD::DrawFIDOOrbitDigitals(RetainedDisplay *skp)
+{
+	FIDOOrbitDigitals *tab;
+
+	if (screen == 41)
+	{
+		skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 1 (MSK 0046)", 18);
+		tab = &GC->rtcc->EZSAVCSM;
+	}
+	else
+	{
+		skp->Text(4 * W / 8, 1 * H / 28, "FDO ORBIT DIGITALS NO 2 (MSK 0045)", 18);
+		tab = &GC->rtcc->EZSAVLEM;
+	}
+
+	skp->SetFont(font2);
+	skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+
+	skp->Text(5 * W / 32, 3 * H / 28, "GET", 3);
+	skp->Text(5 * W / 32, 4 * H / 28, "VEHICLE", 7);
+	skp->Text(5 * W / 32, 5 * H / 28, "REV", 3);
+	skp->Text(5 * W / 32, 6 * H / 28, "REF", 3);
+	skp->Text(5 * W / 32, 7 * H / 28, "GMT ID", 6);
+	skp->Text(5 * W / 32, 8 * H / 28, "GET ID", 6);
+	skp->Text(5 * W / 32, 10 * H / 28, "H", 1);
+	skp->Text(5 * W / 32, 11 * H / 28, "V", 1);
+	skp->Text(5 * W / 32, 12 * H / 28, "GAM", 3);
+	skp->Text(5 * W / 32, 14 * H / 28, "A", 1);
+	skp->Text(5 * W / 32, 15 * H / 28, "E", 1);
+	skp->Text(5 * W / 32, 16 * H / 28, "I", 1);
+	skp->Text(5 * W / 32, 18 * H / 28, "HA", 2);
+	skp->Text(5 * W / 32, 19 * H / 28, "PA", 2);
+	skp->Text(5 * W / 32, 20 * H / 28, "LA", 2);
+	skp->Text(5 * W / 32, 21 * H / 28, "GETA", 4);
+	skp->Text(5 * W / 32, 23 * H / 28, "HP", 2);
+	skp->Text(5 * W / 32, 24 * H / 28, "PP", 2);
+	skp->Text(5 * W / 32, 25 * H / 28, "LP", 2);
+	skp->Text(5 * W / 32, 26 * H / 28, "GETP", 4);
+
+	skp->Text(15 * W / 32, 3 * H / 28, "LPP", 3);
+	skp->Text(15 * W / 32, 4 * H / 28, "PPP", 3);
+	skp->Text(15 * W / 32, 5 * H / 28, "GETCC", 5);
+	skp->Text(15 * W / 32, 6 * H / 28, "TAPP", 4);
+	skp->Text(15 * W / 32, 7 * H / 28, "LNPP", 4);
+
+	skp->Text(25 * W / 32, 3 * H / 28, "REVL", 4);
+	skp->Text(25 * W / 32, 4 * H / 28, "GETL", 4);
+	skp->Text(25 * W / 32, 5 * H / 28, "L", 1);
+	skp->Text(25 * W / 32, 6 * H / 28, "TO", 2);
+	skp->Text(25 * W / 32, 7 * H / 28, "K", 1);
+	skp->Text(25 * W / 32, 8 * H / 28, "ORBWT", 5);
+
+	skp->Text(25 * W / 32, 10 * H / 28, "REQUESTED", 9);
+	skp->Text(23 * W / 32, 11 * H / 28, "REF", 3);
+	skp->Text(23 * W / 32, 12 * H / 28, "GETBV", 5);
+	skp->Text(23 * W / 32, 13 * H / 28, "HA", 2);
+	skp->Text(23 * W / 32, 14 * H / 28, "PA", 2);
+	skp->Text(23 * W / 32, 15 * H / 28, "LA", 2);
+	skp->Text(23 * W / 32, 16 * H / 28, "GETA", 4);
+	skp->Text(23 * W / 32, 18 * H / 28, "HP", 2);
+	skp->Text(23 * W / 32, 19 * H / 28, "PP", 2);
+	skp->Text(23 * W / 32, 20 * H / 28, "LP", 2);
+	skp->Text(23 * W / 32, 21 * H / 28, "GETP", 4);
+
+	skp->SetTextAlign(oapi::Sketchpad::LEFT);
+
+	GET_Display(Buffer, tab->GET, false);
+	skp->Text(3 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, tab->VEHID);
+	skp->Text(3 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%03d", tab->REV);
+	skp->Text(3 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, tab->REF);
+	skp->Text(3 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GMTID, false);
+	skp->Text(3 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETID, false);
+	skp->Text(3 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", tab->H);
+	skp->Text(3 * W / 16, 10 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", tab->V);
+	skp->Text(3 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.2f", tab->GAM);
+	skp->Text(3 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", tab->A);
+	skp->Text(3 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%06.4f", tab->E);
+	skp->Text(3 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", tab->I);
+	skp->Text(3 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
+
+	if (tab->E < 1.0)
+	{
+		sprintf(Buffer, "%08.1f", tab->HA);
+		skp->Text(3 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
+		if (tab->E > 0.0001)
+		{
+			if (tab->PA > 0)
+			{
+				sprintf(Buffer, "%06.2f N", tab->PA);
+			}
+			else
+			{
+				sprintf(Buffer, "%06.2f S", abs(tab->PA));
+			}
+			skp->Text(3 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
+			if (tab->LA > 0)
+			{
+				sprintf(Buffer, "%06.2f E", tab->LA);
+			}
+			else
+			{
+				sprintf(Buffer, "%06.2f W", abs(tab->LA));
+			}
+			skp->Text(3 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
+			GET_Display(Buffer, tab->GETA, false);
+			skp->Text(3 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
+		}
+	}
+
+	sprintf(Buffer, "%08.1f", tab->HP);
+	skp->Text(3 * W / 16, 23 * H / 28, Buffer, strlen(Buffer));
+	if (tab->E > 0.0001)
+	{
+		if (tab->PP > 0)
+		{
+			sprintf(Buffer, "%06.2f N", tab->PP);
+		}
+		else
+		{
+			sprintf(Buffer, "%06.2f S", abs(tab->PP));
+		}
+		skp->Text(3 * W / 16, 24 * H / 28, Buffer, strlen(Buffer));
+		if (tab->LP > 0)
+		{
+			sprintf(Buffer, "%06.2f E", tab->LP);
+		}
+		else
+		{
+			sprintf(Buffer, "%06.2f W", abs(tab->LP));
+		}
+		skp->Text(3 * W / 16, 25 * H / 28, Buffer, strlen(Buffer));
+		GET_Display(Buffer, tab->GETP, false);
+		skp->Text(3 * W / 16, 26 * H / 28, Buffer, strlen(Buffer));
+	}
+
+	if (tab->LPP > 0)
+	{
+		sprintf(Buffer, "%06.2f E", tab->LPP);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(tab->LPP));
+	}
+	skp->Text(8 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
+	if (tab->PPP > 0)
+	{
+		sprintf(Buffer, "%06.2f N", tab->PPP);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(tab->PPP));
+	}
+	skp->Text(8 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETCC, false);
+	skp->Text(8 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+	if (tab->E > 0.0001)
+	{
+		sprintf(Buffer, "%05.1f", tab->TAPP);
+		skp->Text(8 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
+	}
+	if (tab->LNPP > 0)
+	{
+		sprintf(Buffer, "%06.2f E", tab->LNPP);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(tab->LNPP));
+	}
+	skp->Text(8 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%04d", tab->REVL);
+	skp->Text(13 * W / 16, 3 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETL, false);
+	skp->Text(13 * W / 16, 4 * H / 28, Buffer, strlen(Buffer));
+	if (tab->L > 0)
+	{
+		sprintf(Buffer, "%06.2f E", tab->L);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(tab->L));
+	}
+	skp->Text(13 * W / 16, 5 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->TO, false);
+	skp->Text(13 * W / 16, 6 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.1f", tab->K);
+	skp->Text(13 * W / 16, 7 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%07.1f", tab->ORBWT);
+	skp->Text(13 * W / 16, 8 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, tab->REFR);
+	skp->Text(12 * W / 16, 11 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETBV, false);
+	skp->Text(12 * W / 16, 12 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", tab->HAR);
+	skp->Text(12 * W / 16, 13 * H / 28, Buffer, strlen(Buffer));
+	if (tab->PAR > 0)
+	{
+		sprintf(Buffer, "%06.2f N", tab->PAR);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(tab->PAR));
+	}
+	skp->Text(12 * W / 16, 14 * H / 28, Buffer, strlen(Buffer));
+	if (tab->LAR > 0)
+	{
+		sprintf(Buffer, "%06.2f E", tab->LAR);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(tab->LAR));
+	}
+	skp->Text(12 * W / 16, 15 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETAR, false);
+	skp->Text(12 * W / 16, 16 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%08.1f", tab->HPR);
+	skp->Text(12 * W / 16, 18 * H / 28, Buffer, strlen(Buffer));
+	if (tab->PPR > 0)
+	{
+		sprintf(Buffer, "%06.2f N", tab->PPR);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(tab->PPR));
+	}
+	skp->Text(12 * W / 16, 19 * H / 28, Buffer, strlen(Buffer));
+	if (tab->LPR > 0)
+	{
+		sprintf(Buffer, "%06.2f E", tab->LPR);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(tab->LPR));
+	}
+	skp->Text(12 * W / 16, 20 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, tab->GETPR, false);
+	skp->Text(12 * W / 16, 21 * H / 28, Buffer, strlen(Buffer));
+}
+
+void ApolloRTCCMFD::DrawSpaceDigitals(RetainedDisplay *skp)
+{
+	skp->SetTextAlign(oapi::Sketchpad::LEFT);
+
+	if (GC->rtcc->EZETVMED.SpaceDigVehID == 3)
+	{
+		skp->Text(4 * W / 8, 1 * H / 64, "LEM SPACE DIGITALS", 18);
+	}
+	else
+	{
+		skp->Text(4 * W / 8, 1 * H / 64, "CSM SPACE DIGITALS", 18);
+	}
+
+	skp->SetFont(font2);
+
+	skp->Text(1 * W / 32, 2 * H / 28, "STA ID", 6);
+	skp->Text(1 * W / 32, 3 * H / 28, "GMTV", 4);
+	skp->Text(1 * W / 32, 5 * H / 28, "GET", 3);
+	skp->Text(1 * W / 32, 6 * H / 28, "REF", 3);
+	skp->Text(1 * W / 32, 8 * H / 28, "GET VECTOR 1", 12);
+	skp->Text(1 * W / 32, 10 * H / 28, "REF", 3);
+	skp->Text(11 * W / 64, 10 * H / 28, "WT", 2);
+	skp->Text(1 * W / 32, 11 * H / 28, "AREA", 4);
+	skp->Text(1 * W / 32, 12 * H / 28, "GETA", 4);
+	skp->Text(1 * W / 32, 13 * H / 28, "HA", 2);
+	skp->Text(1 * W / 32, 14 * H / 28, "HP", 2);
+	skp->Text(1 * W / 32, 15 * H / 28, "H", 1);
+	skp->Text(1 * W / 32, 16 * H / 28, "V", 1);
+	skp->Text(1 * W / 32, 17 * H / 28, "GAM", 3);
+	skp->Text(1 * W / 32, 18 * H / 28, "PSI", 3);
+	skp->Text(1 * W / 32, 19 * H / 28, "PHI", 3);
+	skp->Text(1 * W / 32, 20 * H / 28, "LAM", 3);
+	skp->Text(1 * W / 32, 21 * H / 28, "HS", 2);
+	skp->Text(1 * W / 32, 22 * H / 28, "HO", 2);
+	skp->Text(1 * W / 32, 23 * H / 28, "PHIO", 4);
+	skp->Text(1 * W / 32, 24 * H / 28, "IEMP", 4);
+	skp->Text(1 * W / 32, 25 * H / 28, "W", 1);
+	skp->Text(1 * W / 32, 26 * H / 28, "OMG", 3);
+	skp->Text(1 * W / 32, 27 * H / 28, "PRA", 3);
+	skp->Text(8 * W / 32, 24 * H / 28, "A", 1);
+	skp->Text(8 * W / 32, 25 * H / 28, "L", 1);
+	skp->Text(8 * W / 32, 26 * H / 28, "E", 1);
+	skp->Text(8 * W / 32, 27 * H / 28, "I", 1);
+
+	skp->Text(11 * W / 32, 2 * H / 28, "WEIGHT", 6);
+	skp->Text(11 * W / 32, 3 * H / 28, "GETV", 4);
+	skp->Text(11 * W / 32, 8 * H / 28, "GET VECTOR 2", 12);
+	skp->Text(11 * W / 32, 10 * H / 28, "GETSI", 5);
+	skp->Text(11 * W / 32, 11 * H / 28, "GETCA", 5);
+	skp->Text(11 * W / 32, 12 * H / 28, "VCA", 3);
+	skp->Text(11 * W / 32, 13 * H / 28, "HCA", 3);
+	skp->Text(11 * W / 32, 14 * H / 28, "PCA", 3);
+	skp->Text(11 * W / 32, 15 * H / 28, "LCA", 3);
+	skp->Text(11 * W / 32, 16 * H / 28, "PSICA", 5);
+	skp->Text(11 * W / 32, 17 * H / 28, "GETMN", 5);
+	skp->Text(11 * W / 32, 18 * H / 28, "HMN", 3);
+	skp->Text(11 * W / 32, 19 * H / 28, "PMN", 3);
+	skp->Text(11 * W / 32, 20 * H / 28, "LMN", 3);
+	skp->Text(11 * W / 32, 21 * H / 28, "DMN", 3);
+
+	skp->Text(21 * W / 32, 3 * H / 28, "GET AXIS", 8);
+	skp->Text(21 * W / 32, 8 * H / 28, "GET VECTOR 3", 12);
+	skp->Text(21 * W / 32, 10 * H / 28, "GETSE", 5);
+	skp->Text(21 * W / 32, 11 * H / 28, "GETEI", 5);
+	skp->Text(21 * W / 32, 12 * H / 28, "VEI", 3);
+	skp->Text(21 * W / 32, 13 * H / 28, "GEI", 3);
+	skp->Text(21 * W / 32, 14 * H / 28, "PEI", 3);
+	skp->Text(21 * W / 32, 15 * H / 28, "LEI", 3);
+	skp->Text(21 * W / 32, 16 * H / 28, "PSIEI", 5);
+	skp->Text(21 * W / 32, 17 * H / 28, "GETVP", 5);
+	skp->Text(21 * W / 32, 18 * H / 28, "VVP", 3);
+	skp->Text(21 * W / 32, 19 * H / 28, "HVP", 3);
+	skp->Text(21 * W / 32, 20 * H / 28, "PVP", 3);
+	skp->Text(21 * W / 32, 21 * H / 28, "LVP", 3);
+	skp->Text(21 * W / 32, 22 * H / 28, "PSI VP", 6);
+	skp->Text(21 * W / 32, 26 * H / 28, "IE", 2);
+	skp->Text(21 * W / 32, 27 * H / 28, "LN", 2);
+
+	skp->Text(9 * W / 32, 5 * H / 28, "V", 1);
+	skp->Text(13 * W / 32, 5 * H / 28, "PHI", 3);
+	skp->Text(20 * W / 32, 5 * H / 28, "H", 1);
+	skp->Text(25 * W / 32, 5 * H / 28, "ADA", 3);
+
+	skp->Text(8 * W / 32, 6 * H / 28, "GAM", 3);
+	skp->Text(15 * W / 32, 6 * H / 28, "LAM", 3);
+	skp->Text(23 * W / 32, 6 * H / 28, "PSI", 3);
+
+	sprintf_s(Buffer, "%s", GC->rtcc->EZSPACE.errormessage.c_str());
+	skp->Text(14 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GMTV, false);
+	skp->Text(4 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GET, false);
+	skp->Text(4 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, GC->rtcc->EZSPACE.REF);
+	skp->Text(4 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%07.1f", GC->rtcc->EZSPACE.WEIGHT);
+	skp->Text(16 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETV, false);
+	skp->Text(14 * W / 32, 3 * H / 28, Buffer, strlen(Buffer));
+
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETR, false);
+	skp->Text(26 * W / 32, 2 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V);
+	skp->Text(10 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PHI > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI));
+	}
+	skp->Text(15 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.H);
+	skp->Text(21 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.ADA);
+	skp->Text(28 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM);
+	skp->Text(11 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LAM > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM));
+	}
+	skp->Text(18 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI);
+	skp->Text(25 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector1, false);
+	skp->Text(1 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector2, false);
+	skp->Text(11 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETVector3, false);
+	skp->Text(21 * W / 32, 9 * H / 28, Buffer, strlen(Buffer));
+
+	skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+
+	skp->Text(25 * W / 32, 2 * H / 28, "GETR", 4);
+
+	sprintf(Buffer, GC->rtcc->EZSPACE.REF1);
+	skp->Text(10 * W / 64, 10 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.WT);
+	skp->Text(10 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HA);
+	skp->Text(10 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HP);
+	skp->Text(10 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.H1);
+	skp->Text(10 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.V1);
+	skp->Text(10 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GAM1);
+	skp->Text(10 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSI1);
+	skp->Text(10 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PHI1 > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHI1);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHI1));
+	}
+	skp->Text(10 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LAM1 > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LAM1);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LAM1));
+	}
+	skp->Text(10 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HS);
+	skp->Text(10 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HO);
+	skp->Text(10 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PHIO > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PHIO);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PHIO));
+	}
+	skp->Text(10 * W / 32, 23 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IEMP);
+	skp->Text(7 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.W1);
+	skp->Text(7 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.OMG);
+	skp->Text(7 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.PRA);
+	skp->Text(7 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+
+	if (GC->rtcc->EZSPACE.A1 > 0)
+	{
+		sprintf(Buffer, "%06.0f", GC->rtcc->EZSPACE.A1);
+		skp->Text(13 * W / 32, 24 * H / 28, Buffer, strlen(Buffer));
+	}
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.L1);
+	skp->Text(13 * W / 32, 25 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%.5f", GC->rtcc->EZSPACE.E1);
+	skp->Text(13 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.I1);
+	skp->Text(13 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETSI, false);
+	skp->Text(20 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETCA, false);
+	skp->Text(20 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VCA);
+	skp->Text(20 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HCA);
+	skp->Text(20 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PCA > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PCA);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PCA));
+	}
+	skp->Text(20 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LCA > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LCA);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LCA));
+	}
+	skp->Text(20 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSICA);
+	skp->Text(20 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETMN, false);
+	skp->Text(20 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HMN);
+	skp->Text(20 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PMN > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PMN);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PMN));
+	}
+	skp->Text(20 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LMN > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LMN);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LMN));
+	}
+	skp->Text(20 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.DMN);
+	skp->Text(20 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+
+
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETSE, false);
+	skp->Text(30 * W / 32, 10 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETEI, false);
+	skp->Text(30 * W / 32, 11 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VEI);
+	skp->Text(30 * W / 32, 12 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.GEI);
+	skp->Text(30 * W / 32, 13 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PEI > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PEI);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PEI));
+	}
+	skp->Text(30 * W / 32, 14 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LEI > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LEI);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LEI));
+	}
+	skp->Text(30 * W / 32, 15 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSIEI);
+	skp->Text(30 * W / 32, 16 * H / 28, Buffer, strlen(Buffer));
+	GET_Display(Buffer, GC->rtcc->EZSPACE.GETVP, false);
+	skp->Text(30 * W / 32, 17 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%05.0f", GC->rtcc->EZSPACE.VVP);
+	skp->Text(30 * W / 32, 18 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%08.1f", GC->rtcc->EZSPACE.HVP);
+	skp->Text(30 * W / 32, 19 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.PVP > 0)
+	{
+		sprintf(Buffer, "%06.2f N", GC->rtcc->EZSPACE.PVP);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f S", abs(GC->rtcc->EZSPACE.PVP));
+	}
+	skp->Text(30 * W / 32, 20 * H / 28, Buffer, strlen(Buffer));
+	if (GC->rtcc->EZSPACE.LVP > 0)
+	{
+		sprintf(Buffer, "%06.2f E", GC->rtcc->EZSPACE.LVP);
+	}
+	else
+	{
+		sprintf(Buffer, "%06.2f W", abs(GC->rtcc->EZSPACE.LVP));
+	}
+	skp->Text(30 * W / 32, 21 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%+06.1f", GC->rtcc->EZSPACE.PSIVP);
+	skp->Text(30 * W / 32, 22 * H / 28, Buffer, strlen(Buffer));
+
+	sprintf(Buffer, "%05.2f", GC->rtcc->EZSPACE.IE);
+	skp->Text(30 * W / 32, 26 * H / 28, Buffer, strlen(Buffer));
+	sprintf(Buffer, "%06.2f", GC->rtcc->EZSPACE.LN);
+	skp->Text(30 * W / 32, 27 * H / 28, Buffer, strlen(Buffer));
+}
+
+void ApolloRTCCMFD::DrawMissionPlanTable(RetainedDisplay *skp)
+{
+	skp->SetTextAlign(oapi::Sketchpad::CENTER);
+	skp->Text(4 * W / 8, 1 * H / 14, "MISSION PLAN TABLE (MSK 0047)", 29);
+	skp->SetTextAlign(oapi::Sketchpad::LEFT);
+	if (GC->MissionPlanningActive)
+	{
+		skp->Text(1 * W / 32, 2 * H / 14, "Active", 6);
+	}
+	else
+	{
+		skp->Text(1 * W / 32, 2 * H / 14, "Inactive", 8);
+	}
+
+	skp->SetFont(font2);
+	skp->SetTextAlign(oapi::Sketchpad::CENTER);
+	skp->Text(3 * W / 32, 8 * H / 28, "GETBI", 5);
+	skp->Text(8 * W / 32, 8 * H / 28, "DT", 2);
+	skp->Text(12 * W / 32, 8 * H / 28, "DELTAV", 6);
+	skp->Text(16 * W / 32, 8 * H / 28, "DVREM", 5);
+	skp->Text(20 * W / 32, 8 * H / 28, "HA", 2);
+	skp->Text(47 * W / 64, 8 * H / 28, "HP", 2);
+	skp->Text(29 * W / 32, 8 * H / 28, "CODE", 4);
+
+	skp->SetTextAlign(oapi::Sketchpad::LEFT);
+
+	skp->Text(6 * W / 32, 5 * H / 28, "CSM STA ID", 10);
+	skp->Text(6 * W / 32, 6 * H / 28, "GETAV", 5);
+	sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.CSMGETAV.c_str());
+	skp->Text(10 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+	skp->Text(18 * W / 32, 5 * H / 28, "LEM STA ID", 10);
+	skp->Text(18 * W / 32, 6 * H / 28, "GETAV", 5);
+	sprintf_s(Buffer, GC->rtcc->MPTDISPLAY.LEMGETAV.c_str());
+	skp->Text(22 * W / 32, 6 * H / 28, Buffer, strlen(Buffer));
+
+	skp->SetTextAlign(oapi::Sketchpad::RIGHT);
+
+	for (unsigned i = 0;i < GC->rtcc->MPTDISPLAY.man.size();i++)
+	{
+		sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].GETBI.c_str());
+		skp->Text(5 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+
+		sprintf(Buffer, "%07.1f", GC->rtcc->MPTDISPLAY.man[i].DELTAV);
+		skp->Text(14 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+
+		sprintf(Buffer, "%.1f", GC->rtcc->MPTDISPLAY.man[i].DVREM);
+		skp->Text(18 * W / 32, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+
+		sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HA);
+		skp->Text(43 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+
+		sprintf(Buffer, "%06.1f", GC->rtcc->MPTDISPLAY.man[i].HP);
+		skp->Text(50 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+
+		sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].code.c_str());
+		skp->Text(63 * W / 64, (i * 2 + 9) * H / 28, Buffer, strlen(Buffer));
+	}
+
+	for (unsigned i = 1;i < GC->rtcc->MPTDISPLAY.man.size();i++)
+	{
+		sprintf(Buffer, GC->rtcc->MPTDISPLAY.man[i].DT.c_str());
+		skp->Text(10 * W / 32, (i * 2 + 8) * H / 28, Buffer, strlen(Buffer));
+	}
+
+}
+
+void ApolloRTCCMFD::DrawNextStationContacts(RetainedDisplay *skp)
+{
+	if (GC->rtcc->MGRTAG == 0)
+	{
+		skp->Text(1 * W / 16, 2 * H / 14, "Lunar", 5);
+	}
+	else
+	{
+		skp->Text(1 * W / 16, 2 * H / 14, "All", 3);
+	}
+
+	skp->SetTextAlign(oapi::Sketchpad::CENTER);
+
+	skp->Text(4 * W / 8, 3 * H / 28, "NEXT STATION CONTACTS (MSK 1503)", 21);
+
+	skp->Text(8 * W / 32, 5 * H / 28, "CSM", 3);
+	skp->Text(24 * W / 32, 5 * H / 28, "LEM", 3);
+
+	skp->SetFont(font2);
+
+	skp->Text(12 * W / 32, 5 * H / 28, "GET", 3);
+
+	skp->Text(2 * W / 32, 17 * H / 56, "STA", 3);
+	skp->Text(6 * W / 32, 8 * H / 28, "GETHCA", 6);
+	skp->Text(6 * W / 32, 9 * H / 28, "DT KLOS", 7);
+	skp->Text(6 * W / 32, 10 * H / 28, "HH MM SS", 8);
+	skp->Text(10 * W / 32, 17 * H / 56, "EMAX", 4);
+	skp->Text(10 * W / 32, 10 * H / 28, "DEG", 4);
+	skp->Text(28 * W / 64, 8 * H / 28, "DTPASS", 6);
+	skp->Text(28 * W / 64, 9 * H / 28, "DT KH", 5);
+	skp->Text(28 * W / 64, 10 * H / 28, "HH MM SS", 8);
+
+	skp->Text(35 * W / 64, 17 * H / 56, "STA", 3);
+	skp->Text(43 * W / 64, 8 * H / 28, "GETHCA", 6);
+	skp->Text(43 * W / 64, 9 * H / 28, "DT KLOS", 7);
+	skp->Text(43 * W / 64, 10 * H / 28, "HH MM SS", 8);
+	skp->Text(51 * W / 64, 17 * H / 56, "EMAX", 4);
+	skp->Text(51 * W / 64, 10 * H / 28, "DEG", 3);
+	skp->Text(59 * W / 64, 8 * H / 28, "DTPASS", 6);
+	skp->Text(59 * W / 64, 9 * H / 28, "DT KH", 5);
+	skp->Text(59 * W / 64, 10 * H / 28, "HH MM SS", 8);
+
+	GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GET, false);
+	skp->Text(16 * W / 32, 5 * H / 28, Buffer, strlen(Buffer));
+
+	unsigned i, j;
+	for (j = 0;j < 2;j++)
+	{
+		for (i = 0;i < 6;i++)
+		{
+			sprintf_s(Buffer, GC->rtcc->NextStationContactsBuffer.STA[j][i].c_str());
+			skp->Text((4 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+
+			if (GC->rtcc->NextStationContactsBuffer.BestAvailableAOS[j][i])
+			{
+				skp->Text((7 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
+			}
+			GET_Display(Buffer, GC->rtcc->NextStationContactsBuffer.GETHCA[j][i], false);
+			skp->Text((12 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+
+			if (GC->rtcc->NextStationContactsBuffer.BestAvailableEMAX[j][i])
+			{
+				skp->Text((17 + j * 31) * W / 64, (2*i + 11) * H / 28, "*", 1);
+			}
+			sprintf_s(Buffer, "%.1f", GC->rtcc->NextStationContactsBuffer.EMAX[j][i]);
+			skp->Text((20 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+
+			GET_Display4(Buffer, GC->rtcc->NextStationContactsBuffer.DTPASS[j][i]);
+			skp->Text((27 + j * 31) * W / 64, (2*i + 11) * H / 28, Buffer, strlen(Buffer));
+		}
+	}
 }
\ No newline at end of file
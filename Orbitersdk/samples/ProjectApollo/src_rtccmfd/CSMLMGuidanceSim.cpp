@@ -27,6 +27,10 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "saturn.h"
 #include "rtcc.h"
 
+//Limits of the variable integration step (s)
+static const double PCSTEPMIN = 2.0;
+static const double PCSTEPMAX = 60.0;
+
 CSMLMPoweredFlightIntegration::CSMLMPoweredFlightIntegration(RTCC *r, PMMRKJInputArray &T, int &I, EphemerisDataTable *E, RTCCNIAuxOutputTable *A) :
 	TArr(T),
 	IERR(I),
@@ -45,6 +49,10 @@ void CSMLMPoweredFlightIntegration::PMMRKJ()
 
 	PCINIT();
 
+	//The variable step size needs steering that doesn't depend on the step
+	KSTEPOP = TArr.ERRTOL > 0.0 && (TArr.MANOP <= 2 || AttGiven);
+	KDENSE = KSTEPOP && TArr.KDENSOP;
+
 	//Thruster switch to 0
 	KTHSWT = 0;
 	//Error indicator to 0
@@ -187,7 +195,7 @@ PMMRKJ_LABEL_8C:
 
 PMMRKJ_LABEL_9A:
 	TE = T + STEP;
-	if (TE > TNEXT)
+	if (TE > TNEXT && KDENSE == false)
 	{
 		TE = TNEXT;
 	}
@@ -806,12 +814,22 @@ void CSMLMPoweredFlightIntegration::PCINIT()
 		}
 	}
 
+	if (TArr.THRMULT != 1.0)
+	{
+		for (int i = 0;i < 10;i++)
+		{
+			THPS[i] *= TArr.THRMULT;
+			WDOTPS[i] *= TArr.THRMULT;
+		}
+	}
+
 	DTTOC = DTSPAN[7];
 }
 
 void CSMLMPoweredFlightIntegration::PCRUNG(EphemerisDataTable *E, std::vector<double> &W)
 {
-	VECTOR3 RDDP1, RDDP2, RDDP3;
+	VECTOR3 RDDP1, RDDP2, RDDP3, R0, V0;
+	double T0, WT0;
 	if (DT != DTPREV)
 	{
 		DT2 = DT / 2.0;
@@ -837,6 +855,13 @@ void CSMLMPoweredFlightIntegration::PCRUNG(EphemerisDataTable *E, std::vector<do
 			VGN = VG;
 		}
 	}
+
+	R0 = R;
+	V0 = V;
+	T0 = T;
+	WT0 = WT;
+	RDDP1 = RDD;
+
 	if (DT == 0.0)
 	{
 		goto PCRUNG_LABEL_4B;
@@ -870,9 +895,18 @@ void CSMLMPoweredFlightIntegration::PCRUNG(EphemerisDataTable *E, std::vector<do
 	V = V + (RDDP1 + (RDDP2 + RDDP3)*2.0 + RDD)*DT6;
 	VP = V;
 
+	if (KSTEPOP)
+	{
+		StepSizeControl(RDDP1, RDDP2, RDDP3, RDD);
+	}
+
 PCRUNG_LABEL_4B:
+	if (KDENSE)
+	{
+		DenseOutput(R0, V0, RDDP1, T0, WT0, E, W);
+	}
 	//Time to store some data
-	if (T == TNEXT)
+	else if (T == TNEXT)
 	{
 		EphemerisData sv;
 
@@ -898,6 +932,84 @@ PCRUNG_LABEL_4B:
 	}
 }
 
+void CSMLMPoweredFlightIntegration::StepSizeControl(VECTOR3 A1, VECTOR3 A2, VECTOR3 A3, VECTOR3 A4)
+{
+	//A step shortened by an event or by the end of the maneuver tells nothing about the step size, keep the current one.
+	//DT of a full step is T + STEP - T, which can differ from STEP by rounding
+	if (DT < STEP - 0.001)
+	{
+		return;
+	}
+	//The second difference of the accelerations over the step gives the fourth order term of the position change.
+	//It is a conservative estimate of the Runge-Kutta error, the next step is scaled so that it meets the tolerance.
+	double ERR = length(A1 - A2 - A3 + A4)*DT*DT / 6.0;
+	double RATIO = 2.0;
+	if (ERR > 0.0)
+	{
+		RATIO = 0.9*pow(TArr.ERRTOL / ERR, 0.25);
+		if (RATIO > 2.0)
+		{
+			RATIO = 2.0;
+		}
+		else if (RATIO < 0.5)
+		{
+			RATIO = 0.5;
+		}
+	}
+	double H = DT * RATIO;
+	if (H < PCSTEPMIN)
+	{
+		H = PCSTEPMIN;
+	}
+	else if (H > PCSTEPMAX)
+	{
+		H = PCSTEPMAX;
+	}
+	STEP = H;
+}
+
+void CSMLMPoweredFlightIntegration::DenseOutput(VECTOR3 R0, VECTOR3 V0, VECTOR3 A0, double T0, double WT0, EphemerisDataTable *E, std::vector<double> &W)
+{
+	//Ephemeris points inside the last step, cubic Hermite interpolation of position and velocity. Weight is linear in time.
+	double H = T - T0;
+
+	while (TNEXT <= T)
+	{
+		EphemerisData sv;
+		double WTN;
+
+		if (H > 0.0)
+		{
+			double S = (TNEXT - T0) / H;
+			double S2 = S * S;
+			double S3 = S2 * S;
+			double H00 = 2.0*S3 - 3.0*S2 + 1.0;
+			double H10 = S3 - 2.0*S2 + S;
+			double H01 = -2.0*S3 + 3.0*S2;
+			double H11 = S3 - S2;
+
+			sv.R = R0 * H00 + V0 * (H10*H) + R * H01 + V * (H11*H);
+			sv.V = V0 * H00 + A0 * (H10*H) + V * H01 + RDD * (H11*H);
+			WTN = WT0 + (WT - WT0)*S;
+		}
+		else
+		{
+			sv.R = R;
+			sv.V = V;
+			WTN = WT;
+		}
+		sv.RBI = TArr.sv0.RBI;
+		sv.GMT = TArr.sv0.GMT + TNEXT;
+		E->table.push_back(sv);
+		TLOP = TNEXT;
+		TNEXT = TNEXT + TArr.DTOUT;
+		if (TArr.KEPHOP == 2)
+		{
+			W.push_back(WTN);
+		}
+	}
+}
+
 void CSMLMPoweredFlightIntegration::PCRDD()
 {
 	double TL, WDOT;
@@ -41,6 +41,8 @@ struct PMMRKJInputArray
 	double LMDESCJETT = 1e10;
 	//Density multiplier
 	double DENSMULT = 1.0;
+	//Thrust multiplier, weight loss rate is scaled with it
+	double THRMULT = 1.0;
 	//Vehicle Cross Section
 	double A = 0.0;
 	//Weight of specified configuration
@@ -86,6 +88,11 @@ struct PMMRKJInputArray
 	bool HeadsUpDownInd;
 	//false = inertial, true = P30
 	bool ExtDVCoordInd;
+	//Position error tolerance of one integration step (m) for the variable step size, 0 for the fixed 2 second step.
+	//Not used with closed-loop steering, which runs on the 2 second guidance cycle.
+	double ERRTOL = 0.0;
+	//Dense ephemeris output option (true to interpolate ephemeris points inside the integration steps, false to end a step at each point)
+	bool KDENSOP = false;
 };
 
 class CSMLMPoweredFlightIntegration
@@ -99,6 +106,8 @@ private:
 	void PCRDD();
 	void PCGUID();
 	void CalcBodyAttitude();
+	void StepSizeControl(VECTOR3 A1, VECTOR3 A2, VECTOR3 A3, VECTOR3 A4);
+	void DenseOutput(VECTOR3 R0, VECTOR3 V0, VECTOR3 A0, double T0, double WT0, EphemerisDataTable *E, std::vector<double> &W);
 
 	//Current position vector
 	VECTOR3 R;
@@ -148,6 +157,10 @@ private:
 	int KGN;
 	//Current integration step
 	double STEP;
+	//Variable step size
+	bool KSTEPOP;
+	//Ephemeris points interpolated inside the steps
+	bool KDENSE;
 	int KEND;
 	//0 = guidance started, 1 = before steering started
 	int IATT;
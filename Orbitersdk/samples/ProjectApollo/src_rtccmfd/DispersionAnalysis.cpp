@@ -0,0 +1,373 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Dispersion Analysis
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "DispersionAnalysis.h"
+#include "TLIGuidanceSim.h"
+#include "EntryCalculations.h"
+#include "OrbMech.h"
+#include "soundlib.h"
+#include "apolloguidance.h"
+#include "saturn.h"
+#include "rtcc.h"
+
+//Wraps an angle difference to -PI to PI
+static double DispersionWrapAngle(double a)
+{
+	return a - PI2 * floor((a + PI) / PI2);
+}
+
+DWORD WINAPI DispersionAnalysis::Trampoline(LPVOID ptr)
+{
+	Worker *w = (Worker *)ptr;
+
+	w->da->RunWorker(w->index);
+	return 0;
+}
+
+DispersionAnalysis::DispersionAnalysis(RTCC *r, const DispersionSettings &set) :
+	settings(set)
+{
+	rtcc = r;
+	Mode = 0;
+	EntryR = EntryV = _V(0, 0, 0);
+	EntryMJD = 0.0;
+	EntryLD = 0.0;
+	EntryRRBIAS = 0.0;
+	EntryICRNGG = 0;
+	RunTime = 0.0;
+}
+
+void DispersionAnalysis::TLI(const RTCCNIInputTable &in, DispersionCutoffStatistics &out)
+{
+	Mode = 1;
+	TLIInput = in;
+	TLIInput.IEPHOP = 0;
+	TLIInput.KAUXOP = true;
+
+	Run();
+	CutoffStatistics(OrbMech::mu_Earth, out);
+	out.RunTime = RunTime;
+}
+
+void DispersionAnalysis::PoweredFlight(const PMMRKJInputArray &in, DispersionCutoffStatistics &out)
+{
+	Mode = 2;
+	PoweredFlightInput = in;
+	PoweredFlightInput.KEPHOP = 0;
+	PoweredFlightInput.KAUXOP = true;
+
+	Run();
+	CutoffStatistics(in.sv0.RBI == BODY_MOON ? OrbMech::mu_Moon : OrbMech::mu_Earth, out);
+	out.RunTime = RunTime;
+}
+
+void DispersionAnalysis::Entry(VECTOR3 R_EI, VECTOR3 V_EI, double MJD_EI, double LD, int ICRNGG, double r_rbias, DispersionLandingStatistics &out)
+{
+	std::vector<double> MJD_L;
+	double dN, dE, cov_NN, cov_EE, cov_NE, tr, det, disc, l1, l2, coslat;
+	unsigned i, n;
+
+	Mode = 3;
+	EntryR = R_EI;
+	EntryV = V_EI;
+	EntryMJD = MJD_EI;
+	EntryLD = LD;
+	EntryICRNGG = ICRNGG;
+	EntryRRBIAS = r_rbias;
+
+	Run();
+
+	out = DispersionLandingStatistics();
+	out.RunTime = RunTime;
+	for (i = 0; i < workers.size(); i++)
+	{
+		for (n = 0; n < workers[i].landing.size(); n++)
+		{
+			out.lat += workers[i].landing[n].lat;
+			//Average around the first case to stay clear of the date line
+			out.lng += DispersionWrapAngle(workers[i].landing[n].lng - workers[0].landing[0].lng);
+			MJD_L.push_back(workers[i].landing[n].MJD_L);
+		}
+	}
+	out.NumValid = MJD_L.size();
+	if (out.NumValid == 0)
+	{
+		return;
+	}
+	out.lat /= (double)out.NumValid;
+	out.lng = DispersionWrapAngle(workers[0].landing[0].lng + out.lng / (double)out.NumValid);
+	ScalarStatistics(MJD_L, out.MJD_L);
+
+	//Covariance in a local north/east plane
+	coslat = cos(out.lat);
+	cov_NN = cov_EE = cov_NE = 0.0;
+	for (i = 0; i < workers.size(); i++)
+	{
+		for (n = 0; n < workers[i].landing.size(); n++)
+		{
+			dN = (workers[i].landing[n].lat - out.lat)*OrbMech::R_Earth;
+			dE = DispersionWrapAngle(workers[i].landing[n].lng - out.lng)*coslat*OrbMech::R_Earth;
+			cov_NN += dN * dN;
+			cov_EE += dE * dE;
+			cov_NE += dN * dE;
+		}
+	}
+	cov_NN /= (double)out.NumValid;
+	cov_EE /= (double)out.NumValid;
+	cov_NE /= (double)out.NumValid;
+
+	//Eigenvalues of the 2x2 covariance matrix are the squared semi-axes
+	tr = cov_NN + cov_EE;
+	det = cov_NN * cov_EE - cov_NE * cov_NE;
+	disc = sqrt(max(0.0, tr*tr / 4.0 - det));
+	l1 = tr / 2.0 + disc;
+	l2 = max(0.0, tr / 2.0 - disc);
+	out.SigmaMajor = sqrt(l1) / 1852.0;
+	out.SigmaMinor = sqrt(l2) / 1852.0;
+	out.AzMajor = 0.5*atan2(2.0*cov_NE, cov_NN - cov_EE);
+	if (out.AzMajor < 0.0)
+	{
+		out.AzMajor += PI;
+	}
+}
+
+void DispersionAnalysis::Run()
+{
+	std::vector<HANDLE> threads;
+	LARGE_INTEGER freq, t0, t1;
+	unsigned i, num;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&t0);
+
+	if (Mode == 3)
+	{
+		//The entry range function only uses the inputs copied into this object and OrbMech math
+		num = settings.NumThreads;
+		if (num == 0)
+		{
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			num = info.dwNumberOfProcessors;
+		}
+	}
+	else
+	{
+		//The TLI and CSM/LM simulations read RTCC tables and call the Orbiter API, so they can't run in parallel
+		num = 1;
+	}
+	num = max(1u, min(num, min(settings.NumCases, (unsigned)MAXIMUM_WAIT_OBJECTS)));
+
+	workers.clear();
+	workers.resize(num);
+	for (i = 0; i < num; i++)
+	{
+		workers[i].da = this;
+		workers[i].index = i;
+		workers[i].rng.seed(settings.Seed + i);
+	}
+
+	if (num == 1)
+	{
+		RunWorker(0);
+	}
+	else
+	{
+		for (i = 0; i < num; i++)
+		{
+			DWORD id = 0;
+			HANDLE h = CreateThread(NULL, 0, Trampoline, &workers[i], 0, &id);
+			if (h == NULL)
+			{
+				//No thread available, run this stream on the calling thread
+				RunWorker(i);
+			}
+			else
+			{
+				threads.push_back(h);
+			}
+		}
+		if (threads.size() > 0)
+		{
+			WaitForMultipleObjects(threads.size(), &threads[0], TRUE, INFINITE);
+		}
+		for (i = 0; i < threads.size(); i++)
+		{
+			CloseHandle(threads[i]);
+		}
+	}
+
+	QueryPerformanceCounter(&t1);
+	RunTime = (double)(t1.QuadPart - t0.QuadPart) / (double)freq.QuadPart;
+}
+
+void DispersionAnalysis::RunWorker(unsigned index)
+{
+	Worker &w = workers[index];
+
+	//Worker i runs cases i, i + N, i + 2N, ... with its own random number stream
+	for (unsigned k = index; k < settings.NumCases; k += workers.size())
+	{
+		RunCase(w);
+	}
+}
+
+void DispersionAnalysis::RunCase(Worker &w)
+{
+	int IERR = 0;
+
+	if (Mode == 1)
+	{
+		RTCCNIInputTable in = TLIInput;
+		RTCCNIAuxOutputTable aux;
+
+		in.R = in.R + GaussVector(w.rng, settings.SigmaR);
+		in.V = in.V + GaussVector(w.rng, settings.SigmaV);
+		in.THRMULT *= 1.0 + Gauss(w.rng, settings.SigmaThrust);
+		in.WDMULT /= 1.0 + Gauss(w.rng, settings.SigmaIsp);
+		in.DENSMULT *= 1.0 + Gauss(w.rng, settings.SigmaDensity);
+
+		TLIGuidanceSim tli(rtcc, in, IERR, NULL, &aux);
+		tli.PCMTRL();
+		if (IERR == 0)
+		{
+			w.cutoff.push_back(aux);
+		}
+	}
+	else if (Mode == 2)
+	{
+		PMMRKJInputArray in = PoweredFlightInput;
+		RTCCNIAuxOutputTable aux;
+
+		in.sv0.R = in.sv0.R + GaussVector(w.rng, settings.SigmaR);
+		in.sv0.V = in.sv0.V + GaussVector(w.rng, settings.SigmaV);
+		in.THRMULT *= 1.0 + Gauss(w.rng, settings.SigmaThrust);
+		in.WDMULT /= 1.0 + Gauss(w.rng, settings.SigmaIsp);
+		in.DENSMULT *= 1.0 + Gauss(w.rng, settings.SigmaDensity);
+
+		CSMLMPoweredFlightIntegration numin(rtcc, in, IERR, NULL, &aux);
+		numin.PMMRKJ();
+		if (IERR == 0)
+		{
+			w.cutoff.push_back(aux);
+		}
+	}
+	else if (Mode == 3)
+	{
+		LandingCase c;
+		VECTOR3 R, V;
+		double LD;
+
+		R = EntryR + GaussVector(w.rng, settings.SigmaR);
+		V = EntryV + GaussVector(w.rng, settings.SigmaV);
+		LD = EntryLD + Gauss(w.rng, settings.SigmaLD);
+
+		EntryCalculations::LNDING(R, V, EntryMJD, LD, EntryICRNGG, EntryRRBIAS, c.lng, c.lat, c.MJD_L);
+		w.landing.push_back(c);
+	}
+}
+
+double DispersionAnalysis::Gauss(std::mt19937 &rng, double sigma)
+{
+	if (sigma == 0.0)
+	{
+		return 0.0;
+	}
+	std::normal_distribution<double> dist(0.0, sigma);
+	return dist(rng);
+}
+
+VECTOR3 DispersionAnalysis::GaussVector(std::mt19937 &rng, double sigma)
+{
+	double x, y, z;
+
+	x = Gauss(rng, sigma);
+	y = Gauss(rng, sigma);
+	z = Gauss(rng, sigma);
+	return _V(x, y, z);
+}
+
+void DispersionAnalysis::CutoffStatistics(double mu, DispersionCutoffStatistics &out)
+{
+	std::vector<double> GMT, DT, DV, WT, R, V, gamma, C3;
+	double r, v;
+	unsigned i, n;
+
+	out = DispersionCutoffStatistics();
+	for (i = 0; i < workers.size(); i++)
+	{
+		for (n = 0; n < workers[i].cutoff.size(); n++)
+		{
+			const RTCCNIAuxOutputTable &aux = workers[i].cutoff[n];
+
+			r = length(aux.R_BO);
+			v = length(aux.V_BO);
+			GMT.push_back(aux.GMT_BO);
+			DT.push_back(aux.DT_B);
+			DV.push_back(aux.DV);
+			WT.push_back(aux.WTEND);
+			R.push_back(r);
+			V.push_back(v);
+			gamma.push_back(asin(dotp(aux.R_BO, aux.V_BO) / (r*v)));
+			C3.push_back(v*v - 2.0*mu / r);
+		}
+	}
+	out.NumValid = GMT.size();
+	ScalarStatistics(GMT, out.GMT_BO);
+	ScalarStatistics(DT, out.DT_B);
+	ScalarStatistics(DV, out.DV);
+	ScalarStatistics(WT, out.WTEND);
+	ScalarStatistics(R, out.R_BO);
+	ScalarStatistics(V, out.V_BO);
+	ScalarStatistics(gamma, out.Gamma_BO);
+	ScalarStatistics(C3, out.C3);
+}
+
+void DispersionAnalysis::ScalarStatistics(const std::vector<double> &data, DispersionScalarStatistics &out)
+{
+	double sum, sum2;
+	unsigned i;
+
+	out = DispersionScalarStatistics();
+	if (data.size() == 0)
+	{
+		return;
+	}
+
+	sum = 0.0;
+	out.Min = out.Max = data[0];
+	for (i = 0; i < data.size(); i++)
+	{
+		sum += data[i];
+		out.Min = min(out.Min, data[i]);
+		out.Max = max(out.Max, data[i]);
+	}
+	out.Mean = sum / (double)data.size();
+
+	sum2 = 0.0;
+	for (i = 0; i < data.size(); i++)
+	{
+		sum2 += (data[i] - out.Mean)*(data[i] - out.Mean);
+	}
+	out.Sigma = sqrt(sum2 / (double)data.size());
+}
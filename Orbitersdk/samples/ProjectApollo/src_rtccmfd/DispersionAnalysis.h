@@ -0,0 +1,155 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC Dispersion Analysis (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <random>
+#include "Orbitersdk.h"
+#include "RTCCTables.h"
+#include "CSMLMGuidanceSim.h"
+
+class RTCC;
+
+struct DispersionSettings
+{
+	//Number of perturbed cases
+	unsigned NumCases = 1000;
+	//Seed of the random number streams, worker thread i uses Seed + i
+	unsigned Seed = 1;
+	//Number of worker threads for entry cases (0 = one per processor). TLI and powered flight cases always run on the calling thread,
+	//because their simulations read RTCC tables and the Orbiter API.
+	unsigned NumThreads = 0;
+	//1-sigma position error per axis (m)
+	double SigmaR = 0.0;
+	//1-sigma velocity error per axis (m/s)
+	double SigmaV = 0.0;
+	//1-sigma relative thrust error
+	double SigmaThrust = 0.0;
+	//1-sigma relative Isp error
+	double SigmaIsp = 0.0;
+	//1-sigma relative atmospheric density error (TLI and powered flight only, the entry range function has no density input)
+	double SigmaDensity = 0.0;
+	//1-sigma error of the lift-to-drag ratio (entry only)
+	double SigmaLD = 0.0;
+};
+
+struct DispersionScalarStatistics
+{
+	double Mean = 0.0;
+	double Sigma = 0.0;
+	double Min = 0.0;
+	double Max = 0.0;
+};
+
+struct DispersionCutoffStatistics
+{
+	//Number of cases without integration error
+	unsigned NumValid = 0;
+	//Wall clock time of all cases (s)
+	double RunTime = 0.0;
+	//GMT of end of maneuver
+	DispersionScalarStatistics GMT_BO;
+	//Duration of main engine burn to cutoff signal
+	DispersionScalarStatistics DT_B;
+	//Total DV
+	DispersionScalarStatistics DV;
+	//Weight at end of maneuver
+	DispersionScalarStatistics WTEND;
+	//Radius at cutoff
+	DispersionScalarStatistics R_BO;
+	//Velocity at cutoff
+	DispersionScalarStatistics V_BO;
+	//Flight path angle at cutoff
+	DispersionScalarStatistics Gamma_BO;
+	//Twice the specific energy at cutoff (C3)
+	DispersionScalarStatistics C3;
+};
+
+struct DispersionLandingStatistics
+{
+	//Number of cases
+	unsigned NumValid = 0;
+	//Wall clock time of all cases (s)
+	double RunTime = 0.0;
+	//Mean geodetic latitude and longitude of landing
+	double lat = 0.0;
+	double lng = 0.0;
+	//1-sigma semi-major and semi-minor axis of the landing ellipse (NM)
+	double SigmaMajor = 0.0;
+	double SigmaMinor = 0.0;
+	//Azimuth of the semi-major axis, measured from north
+	double AzMajor = 0.0;
+	//MJD of landing
+	DispersionScalarStatistics MJD_L;
+};
+
+class DispersionAnalysis
+{
+public:
+	DispersionAnalysis(RTCC *r, const DispersionSettings &set);
+	//Dispersed S-IVB TLI simulations (PMMSIU)
+	void TLI(const RTCCNIInputTable &in, DispersionCutoffStatistics &out);
+	//Dispersed CSM and LM maneuver simulations (PMMRKJ)
+	void PoweredFlight(const PMMRKJInputArray &in, DispersionCutoffStatistics &out);
+	//Dispersed entry interface states, landing point from the entry range function
+	void Entry(VECTOR3 R_EI, VECTOR3 V_EI, double MJD_EI, double LD, int ICRNGG, double r_rbias, DispersionLandingStatistics &out);
+
+protected:
+	struct LandingCase
+	{
+		double lat, lng, MJD_L;
+	};
+
+	struct Worker
+	{
+		DispersionAnalysis *da;
+		unsigned index;
+		std::mt19937 rng;
+		std::vector<RTCCNIAuxOutputTable> cutoff;
+		std::vector<LandingCase> landing;
+	};
+
+	static DWORD WINAPI Trampoline(LPVOID ptr);
+	void Run();
+	void RunWorker(unsigned index);
+	void RunCase(Worker &w);
+	VECTOR3 GaussVector(std::mt19937 &rng, double sigma);
+	double Gauss(std::mt19937 &rng, double sigma);
+	void CutoffStatistics(double mu, DispersionCutoffStatistics &out);
+	void ScalarStatistics(const std::vector<double> &data, DispersionScalarStatistics &out);
+
+	RTCC *rtcc;
+	DispersionSettings settings;
+	std::vector<Worker> workers;
+
+	//1 = TLI, 2 = CSM/LM powered flight, 3 = entry
+	int Mode;
+	RTCCNIInputTable TLIInput;
+	PMMRKJInputArray PoweredFlightInput;
+	VECTOR3 EntryR, EntryV;
+	double EntryMJD, EntryLD, EntryRRBIAS;
+	int EntryICRNGG;
+	//Wall clock time of the last Run
+	double RunTime;
+};
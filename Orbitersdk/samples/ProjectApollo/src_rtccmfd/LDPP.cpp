@@ -80,6 +80,8 @@ LDPP::LDPP()
 
 void LDPP::Init(const LDPPOptions &in)
 {
+	trajectories.Clear();
+
 	opt.azi_nom = in.azi_nom;
 	opt.GETbase = in.GETbase;
 	opt.H_DP = in.H_DP;
@@ -152,7 +154,7 @@ int LDPP::LDPPMain(LDPPResults &out)
 	{
 		MJD = OrbMech::P29TimeOfLongitude(sv_CSM.R, sv_CSM.V, sv_CSM.MJD, hMoon, opt.Lng_LS);
 		t_LS = OrbMech::GETfromMJD(MJD, opt.GETbase);
-		sv_CSM = OrbMech::coast(sv_CSM, (MJD - sv_CSM.MJD)*24.0*3600.0);
+		sv_CSM = COAST(sv_CSM, (MJD - sv_CSM.MJD)*24.0*3600.0);
 		OrbMech::EclipticToMCI(sv_CSM.R, sv_CSM.V, sv_CSM.MJD, R_temp, V_temp);
 		U_CSM = ArgLat(R_temp, V_temp);
 		if (U_CSM < U_OC)
@@ -170,7 +172,7 @@ int LDPP::LDPPMain(LDPPResults &out)
 		{
 			t_D = t_LS + 20.0*60.0;
 			dt = t_D - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-			sv_CSM = OrbMech::coast(sv_CSM, dt);
+			sv_CSM = COAST(sv_CSM, dt);
 		}
 	} while (DU_1 < DU_2);
 
@@ -200,7 +202,7 @@ LDPP_3_2:
 	}
 LDPP_3_3:
 	dt = t_PC - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	LDPP_SV_E[i - 1][0] = sv_CSM;
 LDPP_4_1:
 	sv_CSM = APPLY(sv_CSM, DV_apo);
@@ -212,7 +214,7 @@ LDPP_4_1:
 
 LDPP_5_1:
 	dt = t_PC - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	DV = SAC(2, 0, 1, sv_CSM);
 	LDPP_SV_E[i - 1][0] = sv_CSM;
 	DV_apo = DV + DV_apo;
@@ -230,7 +232,7 @@ LDPP_6_1:
 LDPP_6_2:
 	LLTPR(opt.TH[i - 1], sv_CSM, t_DOI, t_IGN, t_L);
 	dt = t_DOI - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	sv_LM = sv_CSM;
 	//Page 7
 	LDPP_SV_E[i - 1][0] = sv_LM;
@@ -241,7 +243,7 @@ LDPP_6_2:
 	DeltaV_LVLH[i - 1] = DV;
 	//Page 8
 	dt = t_IGN - OrbMech::GETfromMJD(sv_LM.MJD, opt.GETbase);
-	sv_LM = OrbMech::coast(sv_LM, dt);
+	sv_LM = COAST(sv_LM, dt);
 
 	if (IRUT <= 0)
 	{
@@ -250,7 +252,7 @@ LDPP_6_2:
 
 	MJD = OrbMech::MJDfromGET(t_IGN + opt.t_D, opt.GETbase);
 	dt = (MJD - sv_LM.MJD)*24.0*3600.0;
-	sv_LM = OrbMech::coast(sv_LM, dt);
+	sv_LM = COAST(sv_LM, dt);
 	RR_LM = unit(sv_LM.R);
 	VV_LM = unit(sv_LM.V);
 	HH_LM = unit(crossp(RR_LM, VV_LM));
@@ -281,7 +283,7 @@ LDPP_9_3:
 		t_H_DOI = t_M[i - 2];
 	}
 	dt = t_H_DOI - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	goto LDPP_6_2;
 
 LDPP_10_1:
@@ -292,7 +294,7 @@ LDPP_10_1:
 	if (opt.IDO >= 0)
 	{
 		dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-		sv_CSM = OrbMech::coast(sv_CSM, dt);
+		sv_CSM = COAST(sv_CSM, dt);
 		sv_CSM = STAP(sv_CSM, error);
 		if (error)
 		{
@@ -305,7 +307,7 @@ LDPP_10_1:
 		t_M[i - 1] = opt.TH[i - 1];
 	LDPP_10_2:
 		dt = t_M[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-		sv_CSM = OrbMech::coast(sv_CSM, dt);
+		sv_CSM = COAST(sv_CSM, dt);
 	}
 	DV = SAC(2, opt.H_W, 0, sv_CSM);
 	//Page 11
@@ -324,7 +326,7 @@ LDPP_10_1:
 		opt.TH[i - 1] = t_M[i - 2];
 	}
 	dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	do
 	{
 		sv_CSM = STAP(sv_CSM, error);
@@ -350,7 +352,7 @@ LDPP_14_1:
 		goto LDPP_15_1;
 	}
 	dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	if (STCIR(sv_CSM, opt.H_W, true, sv_CSM))
 	{
 		return 1;
@@ -383,7 +385,7 @@ LDPP_15_2:
 	P_L = OrbMech::period(sv_CSM.R, sv_CSM.V, mu);
 	t_D = t_M[i - 1] + P_L * trunc((t_H_DOI - opt.TH[i - 1]) / P_L);
 	dt = t_D - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	//Page 17
 	sv_CSM = STAP(sv_CSM, error);
 	if (error)
@@ -405,7 +407,7 @@ LDPP_15_2:
 		U_OC += PI2;
 	}
 	dt = t_M[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	goto LDPP_15_2;
 	//Page 18
 LDPP_18_1:
@@ -463,7 +465,7 @@ LDPP_19_1:
 	}
 LDPP_19_2:
 	dt = T_GO - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	sv_CSM = STAP(sv_CSM, error);
 	if (error)
 	{
@@ -485,7 +487,7 @@ LDPP_19_2:
 	if (I_PC == 2)
 	{
 		dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-		sv_CSM = OrbMech::coast(sv_CSM, dt);
+		sv_CSM = COAST(sv_CSM, dt);
 		LDPP_SV_E[i - 1][0] = sv_CSM;
 		LDPP_SV_E[i - 1][1] = sv_CSM;
 		t_M[i - 1] = opt.TH[i - 1];
@@ -493,7 +495,7 @@ LDPP_19_2:
 	}
 LDPP_21_2:
 	dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	do
 	{
 		sv_CSM = STAP(sv_CSM, error);
@@ -524,7 +526,7 @@ LDPP_23_1:
 	}
 	sv_CSM = sv_V;
 	dt = t_PC - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	LDPP_SV_E[i - 1][0] = sv_CSM;
 	//Page 24
 	sv_CSM = APPLY(sv_CSM, DV_apo);
@@ -543,7 +545,7 @@ LDPP_25_2:
 	i = 2;
 	sv_CSM = LDPP_SV_E[1][1];
 	dt = t_PC - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	//Page 26
 	i++;
 	LDPP_SV_E[i - 1][0] = sv_CSM;
@@ -558,7 +560,7 @@ LDPP_27_1:
 	sv_CSM = LDPP_SV_E[0][1];
 	i = 2;
 	dt = t_PC - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	LDPP_SV_E[i - 1][0] = sv_CSM;
 	sv_CSM = APPLY(sv_CSM, DV_apo);
 	LDPP_SV_E[i - 1][1] = sv_CSM;
@@ -578,7 +580,7 @@ LDPP_29_1:
 	}
 
 	dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 
 	if (opt.MODE < 7)
 	{
@@ -598,11 +600,11 @@ LDPP_30_1:
 		opt.TH[i - 1] = t_M[i - 2];
 	}
 	dt = opt.TH[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 
 	MJD = OrbMech::P29TimeOfLongitude(sv_CSM.R, sv_CSM.V, sv_CSM.MJD, hMoon, opt.Lng_LS);
 	dt = (MJD - sv_CSM.MJD)*24.0*3600.0;
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 
 	RR_LS = LATLON(MJD);
 	RR_CSM = unit(sv_CSM.R);
@@ -680,7 +682,7 @@ LDPP_34_1:
 	deltaw_s = 0.0;
 	IRUT = 1;
 	dt = t_M[i - 1] - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	OrbMech::EclipticToMCI(sv_CSM.R, sv_CSM.V, sv_CSM.MJD, R_temp, V_temp);
 	u_man = ArgLat(R_temp, V_temp);
 	LDPP_SV_E[i - 1][0] = sv_CSM;
@@ -703,7 +705,7 @@ LDPP_35_1:
 		t_H_DOI = t_M[i - 2];
 	}
 	dt = t_H_DOI - OrbMech::GETfromMJD(sv_CSM.MJD, opt.GETbase);
-	sv_CSM = OrbMech::coast(sv_CSM, dt);
+	sv_CSM = COAST(sv_CSM, dt);
 	goto LDPP_6_2;
 }
 
@@ -764,7 +766,7 @@ VECTOR3 LDPP::SAC(int L, double h_W, int J, SV sv_L)
 				dt = (u_d - u_c) / n;
 			}
 			
-			sv_L2 = OrbMech::coast(sv_L2, dt);
+			sv_L2 = COAST(sv_L2, dt);
 			R = rhtmul(Rot, sv_L2.R);
 			V = rhtmul(Rot, sv_L2.V);
 			u_c = ArgLat(R, V);
@@ -805,6 +807,11 @@ VECTOR3 LDPP::LATLON(double MJD)
 	return rhmul(OrbMech::GetRotationMatrix(BODY_MOON, MJD), OrbMech::r_from_latlong(opt.Lat_LS, opt.Lng_LS, opt.R_LS));
 }
 
+SV LDPP::COAST(SV sv0, double dt)
+{
+	return trajectories.coast(sv0, dt);
+}
+
 void LDPP::LLTPR(double T_H, SV sv_L, double &t_DOI, double &t_IGN, double &t_TD)
 {
 	SV sv_L0;
@@ -830,7 +837,7 @@ void LDPP::LLTPR(double T_H, SV sv_L, double &t_DOI, double &t_IGN, double &t_TD
 		}
 
 		t = t + S_w * dt;
-		sv_L = OrbMech::coast(sv_L, t - OrbMech::GETfromMJD(sv_L.MJD, opt.GETbase));
+		sv_L = COAST(sv_L, t - OrbMech::GETfromMJD(sv_L.MJD, opt.GETbase));
 
 		S = 0;
 		R_p = R_D;
@@ -1085,6 +1092,77 @@ LDPP_CHAPLA_9_1:
 	DV.z = dv_r;
 }
 
+SV LDPPTrajectoryTable::coast(SV sv0, double dt)
+{
+	if (dt == 0.0)
+	{
+		return sv0;
+	}
+
+	std::vector<SV> *traj = NULL;
+	double MJD = sv0.MJD + dt / 24.0 / 3600.0;
+
+	//Is the state vector on a known trajectory? It then becomes the most recently used one.
+	for (unsigned i = 0;i < trajectories.size() && traj == NULL;i++)
+	{
+		for (unsigned j = 0;j < trajectories[i].size();j++)
+		{
+			if (SameState(trajectories[i][j], sv0))
+			{
+				trajectories.push_back(std::vector<SV>());
+				trajectories.back().swap(trajectories[i]);
+				trajectories.erase(trajectories.begin() + i);
+				traj = &trajectories.back();
+				break;
+			}
+		}
+	}
+
+	if (traj == NULL)
+	{
+		if (trajectories.size() >= MaxTrajectories)
+		{
+			trajectories.erase(trajectories.begin());
+		}
+		trajectories.push_back(std::vector<SV>(1, sv0));
+		traj = &trajectories.back();
+	}
+
+	//Start from the state closest in time, forwards or backwards
+	unsigned k = 0;
+	for (unsigned j = 1;j < traj->size();j++)
+	{
+		if (fabs((*traj)[j].MJD - MJD) < fabs((*traj)[k].MJD - MJD))
+		{
+			k = j;
+		}
+	}
+
+	SV sv1 = (*traj)[k];
+	double DT = (MJD - sv1.MJD)*24.0*3600.0;
+	if (DT != 0.0)
+	{
+		sv1 = OrbMech::coast(sv1, DT);
+		sv1.MJD = MJD;
+		if (traj->size() < MaxStates)
+		{
+			traj->push_back(sv1);
+		}
+	}
+	sv1.mass = sv0.mass;
+	return sv1;
+}
+
+void LDPPTrajectoryTable::Clear()
+{
+	trajectories.clear();
+}
+
+bool LDPPTrajectoryTable::SameState(const SV &sv1, const SV &sv2)
+{
+	return sv1.MJD == sv2.MJD && sv1.gravref == sv2.gravref && sv1.R.x == sv2.R.x && sv1.R.y == sv2.R.y && sv1.R.z == sv2.R.z && sv1.V.x == sv2.V.x && sv1.V.y == sv2.V.y && sv1.V.z == sv2.V.z;
+}
+
 SV LDPP::APPLY(SV sv0, VECTOR3 dV_LVLH)
 {
 	sv0.V += tmul(OrbMech::LVLH_Matrix(sv0.R, sv0.V), dV_LVLH);
@@ -1163,7 +1241,7 @@ bool LDPP::STCIR(SV sv0, double h_W, bool ca_flag, SV& sv_out)
 	}
 	do
 	{
-		sv0 = OrbMech::coast(sv0, dt);
+		sv0 = COAST(sv0, dt);
 		coe = OrbMech::GIMIKC(sv0.R, sv0.V, mu);
 		cos_f_cf = (coe.a*(1.0 - coe.e*coe.e) - r_H) / (coe.e*r_H);
 
@@ -1219,7 +1297,7 @@ bool LDPP::STCIR(SV sv0, double h_W, bool ca_flag, SV& sv_out)
 		dt2 = dt21;
 	}
 
-	sv_out = OrbMech::coast(sv0, dt2);
+	sv_out = COAST(sv0, dt2);
 	return false;*/
 }
 
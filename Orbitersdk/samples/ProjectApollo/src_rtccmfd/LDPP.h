@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <vector>
 #include "OrbMech.h"
 
 struct LDPPOptions
@@ -86,6 +87,25 @@ struct LDPPResults
 	VECTOR3 V_after[4];
 };
 
+//Table of the integrated coasting trajectories. The LDPP iterations coast from the same state vector to many different times,
+//a coast that starts on a known trajectory is integrated from the stored state closest in time instead of from the beginning.
+//Each LDPP run starts with an empty table, so the results don't depend on earlier runs.
+class LDPPTrajectoryTable
+{
+public:
+	//Same as OrbMech::coast
+	SV coast(SV sv0, double dt);
+	void Clear();
+protected:
+	static bool SameState(const SV &sv1, const SV &sv2);
+
+	//Each trajectory is the list of all states that were integrated on it. Least recently used first.
+	std::vector<std::vector<SV>> trajectories;
+
+	static const unsigned MaxTrajectories = 8;
+	static const unsigned MaxStates = 256;
+};
+
 class LDPP
 {
 public:
@@ -106,6 +126,7 @@ protected:
 	SV TIMA(SV sv0, double u, bool &error);
 	SV APPLY(SV sv0, VECTOR3 dV_LVLH);
 	VECTOR3 LATLON(double MJD);
+	SV COAST(SV sv0, double dt);
 	double mu;
 	OBJHANDLE hMoon;
 	//Number of the plane-change maneuver
@@ -126,6 +147,8 @@ protected:
 
 	LDPPOptions opt;
 
+	LDPPTrajectoryTable trajectories;
+
 	//Angular iteration tolerance
 	static const double zeta_theta;
 	//time iteration tolerance
@@ -1,6 +1,8 @@
 #include "OrbMech.h"
+#include "thread.h"
 #include <limits>
 #include <vector>
+#include <cstring>
 
 inline double acosh(double z) { return log(z + sqrt(z + 1.0)*sqrt(z - 1.0)); }
 inline double atanh(double z){ return 0.5*log(1.0 + z) - 0.5*log(1.0 - z); }
@@ -42,6 +44,139 @@ MPTSV& MPTSV::operator=(const SV& other)
 
 namespace OrbMech{
 
+	//Direct-mapped table of conic results, keyed on the exact bit pattern of the inputs
+	template <int NIN, int NOUT> struct ConicCacheTable
+	{
+		static const unsigned Size = 256;
+		struct Entry
+		{
+			bool valid;
+			double in[NIN];
+			double out[NOUT];
+		};
+		Entry table[Size];
+
+		ConicCacheTable()
+		{
+			for (unsigned i = 0; i < Size; i++)
+			{
+				table[i].valid = false;
+			}
+		}
+		static unsigned Hash(const double *in)
+		{
+			//FNV-1a
+			const unsigned char *p = (const unsigned char *)in;
+			unsigned h = 2166136261u;
+			for (unsigned i = 0; i < NIN * sizeof(double); i++)
+			{
+				h ^= p[i];
+				h *= 16777619u;
+			}
+			return h % Size;
+		}
+		bool Find(const double *in, double *out)
+		{
+			Entry &e = table[Hash(in)];
+			if (e.valid && memcmp(e.in, in, sizeof(e.in)) == 0)
+			{
+				memcpy(out, e.out, sizeof(e.out));
+				return true;
+			}
+			return false;
+		}
+		void Store(const double *in, const double *out)
+		{
+			Entry &e = table[Hash(in)];
+			memcpy(e.in, in, sizeof(e.in));
+			memcpy(e.out, out, sizeof(e.out));
+			e.valid = true;
+		}
+	};
+
+	struct ConicCache
+	{
+		template <int NIN, int NOUT> bool Find(int type, ConicCacheTable<NIN, NOUT> &table, const double *in, double *out)
+		{
+			if (table.Find(in, out))
+			{
+				stats.Hits[type]++;
+				return true;
+			}
+			stats.Misses[type]++;
+			return false;
+		}
+
+		int RefCount = 0;
+		ConicCacheStatistics stats;
+		ConicCacheTable<3, 1> kepler_E;
+		ConicCacheTable<13, 3> lambert;
+		ConicCacheTable<8, 1> time_theta;
+		ConicCacheTable<8, 6> rv_ta;
+	};
+
+	static thread_local ConicCache *conicCache = NULL;
+
+	//Lookups in the matrix table of the mission time window, false if there is none or the time is outside of it
+	static bool RotationMatrixFromTable(int plan, double t, MATRIX3 &R);
+	static bool ObliquityMatrixFromTable(int plan, double t, MATRIX3 &R);
+	static bool J2000EclToBRCSFromTable(double mjd, MATRIX3 &R);
+
+	void EnableConicCache(bool enable)
+	{
+		if (enable)
+		{
+			if (conicCache == NULL)
+			{
+				conicCache = new ConicCache;
+			}
+			conicCache->RefCount++;
+		}
+		else if (conicCache)
+		{
+			conicCache->RefCount--;
+			if (conicCache->RefCount <= 0)
+			{
+				delete conicCache;
+				conicCache = NULL;
+			}
+		}
+	}
+
+	ConicCache *CreateConicCache()
+	{
+		return new ConicCache;
+	}
+
+	void DeleteConicCache(ConicCache *cache)
+	{
+		delete cache;
+	}
+
+	void AttachConicCache(ConicCache *cache)
+	{
+		//The reference held while attached keeps EnableConicCache(false) from freeing a cache it doesn't own
+		if (conicCache)
+		{
+			conicCache->RefCount--;
+		}
+		conicCache = cache;
+		if (conicCache)
+		{
+			conicCache->RefCount++;
+		}
+	}
+
+	bool GetConicCacheStatistics(ConicCacheStatistics &stats)
+	{
+		if (conicCache == NULL)
+		{
+			return false;
+		}
+		stats = conicCache->stats;
+		return true;
+	}
+
 	double period(VECTOR3 R, VECTOR3 V, double mu)
 	{
 		double a, epsilon;
@@ -234,13 +369,29 @@ double fischer_ellipsoid(VECTOR3 R)		//Used in the AGC to calculate the radius o
 
 void rv_from_r0v0_ta(VECTOR3 R0, VECTOR3 V0, double dt, VECTOR3 &R1, VECTOR3 &V1, double mu)
 {
+	double in[8] = { R0.x, R0.y, R0.z, V0.x, V0.y, V0.z, dt, mu };
+	double out[6];
 	double f, g, fdot, gdot;
 
+	if (conicCache && conicCache->Find(CONIC_CACHE_RV_TA, conicCache->rv_ta, in, out))
+	{
+		R1 = _V(out[0], out[1], out[2]);
+		V1 = _V(out[3], out[4], out[5]);
+		return;
+	}
+
 	f_and_g_ta(R0, V0, dt, f, g, mu);
 	fDot_and_gDot_ta(R0, V0, dt, fdot, gdot, mu);
 
 	R1 = R0*f + V0*g;
 	V1 = R0*fdot + V0*gdot;
+
+	if (conicCache)
+	{
+		out[0] = R1.x; out[1] = R1.y; out[2] = R1.z;
+		out[3] = V1.x; out[4] = V1.y; out[5] = V1.z;
+		conicCache->rv_ta.Store(in, out);
+	}
 }
 
 void f_and_g_ta(VECTOR3 R0, VECTOR3 V0, double dt, double &f, double &g, double mu)
@@ -269,7 +420,7 @@ void fDot_and_gDot_ta(VECTOR3 R0, VECTOR3 V0, double dt, double &fdot, double &g
 	gdot = 1 - mu*r0 / (h*h) * (1 - c);
 }
 
-double time_theta(VECTOR3 R, VECTOR3 V, double dtheta, double mu)
+static double time_theta_calc(VECTOR3 R, VECTOR3 V, double dtheta, double mu)
 {
 	double r, v, alpha, a, f, g, fdot, gdot, sigma0, r1, dt, h, p;
 
@@ -319,6 +470,23 @@ double time_theta(VECTOR3 R, VECTOR3 V, double dtheta, double mu)
 	return dt;
 }
 
+double time_theta(VECTOR3 R, VECTOR3 V, double dtheta, double mu)
+{
+	double in[8] = { R.x, R.y, R.z, V.x, V.y, V.z, dtheta, mu };
+	double dt;
+
+	if (conicCache && conicCache->Find(CONIC_CACHE_TIME_THETA, conicCache->time_theta, in, &dt))
+	{
+		return dt;
+	}
+	dt = time_theta_calc(R, V, dtheta, mu);
+	if (conicCache)
+	{
+		conicCache->time_theta.Store(in, &dt);
+	}
+	return dt;
+}
+
 void ra_and_dec_from_r(VECTOR3 R, double &ra, double &dec)
 {
 	double r, l, m, n;
@@ -506,7 +674,7 @@ void fDot_and_gDot(double x, double r, double ro, double a, double &fdot, double
 	gdot = 1.0 - x*x / r*stumpC(z);
 }
 
-double kepler_E(double e, double M, double error2)
+static double kepler_E_calc(double e, double M, double error2)
 {
 	double ratio, E;
 	//{
@@ -538,6 +706,23 @@ double kepler_E(double e, double M, double error2)
 	return E;
 } //kepler_E
 
+double kepler_E(double e, double M, double error2)
+{
+	double in[3] = { e, M, error2 };
+	double E;
+
+	if (conicCache && conicCache->Find(CONIC_CACHE_KEPLER_E, conicCache->kepler_E, in, &E))
+	{
+		return E;
+	}
+	E = kepler_E_calc(e, M, error2);
+	if (conicCache)
+	{
+		conicCache->kepler_E.Store(in, &E);
+	}
+	return E;
+}
+
 double kepler_H(double e, double M)
 {
 	double error2, F, ratio;
@@ -879,7 +1064,7 @@ MATRIX3 MEGMatrix(double theta_E)
 	return _M(cos(theta_E), sin(theta_E), 0, 0, 0, -1, -sin(theta_E), cos(theta_E), 0);
 }
 
-VECTOR3 elegant_lambert(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bool prog, double mu)
+static VECTOR3 elegant_lambert_calc(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bool prog, double mu)
 {
 	double tol, ratio, r1, r2, c, s, theta, lambda, T, l, m, x, h1, h2, B, y, z, x_new, A;
 	int nMax, n;
@@ -1004,6 +1189,23 @@ VECTOR3 elegant_lambert(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bo
 	}
 }
 
+VECTOR3 elegant_lambert(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bool prog, double mu)
+{
+	double in[13] = { R1.x, R1.y, R1.z, V1.x, V1.y, V1.z, R2.x, R2.y, R2.z, dt, (double)N, prog ? 1.0 : 0.0, mu };
+	VECTOR3 Vt;
+
+	if (conicCache && conicCache->Find(CONIC_CACHE_LAMBERT, conicCache->lambert, in, Vt.data))
+	{
+		return Vt;
+	}
+	Vt = elegant_lambert_calc(R1, V1, R2, dt, N, prog, mu);
+	if (conicCache)
+	{
+		conicCache->lambert.Store(in, Vt.data);
+	}
+	return Vt;
+}
+
 bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, int gravref, int &gravout)
 {
 	bool stop, soichange;
@@ -1022,6 +1224,58 @@ bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1,
 	return soichange;
 }
 
+void oneclickcoast(const std::vector<VECTOR3> &R0, const std::vector<VECTOR3> &V0, double mjd0, double dt, std::vector<VECTOR3> &R1, std::vector<VECTOR3> &V1, int gravref, int gravout)
+{
+	//All trajectories use the smallest step size of the set, so they arrive at the same times and share one evaluation of the Moon and Sun ephemeris
+	CoastEphemerisCache ephem;
+	std::vector<CoastIntegrator> coast;
+	unsigned i, n;
+	double h, h_i;
+	bool stop;
+
+	n = R0.size();
+	if (gravout == -1)
+	{
+		gravout = gravref;
+	}
+
+	coast.reserve(n);
+	for (i = 0; i < n; i++)
+	{
+		coast.push_back(CoastIntegrator(R0[i], V0[i], mjd0, dt, gravref, gravout, &ephem));
+	}
+
+	stop = (n == 0);
+	while (stop == false)
+	{
+		h = coast[0].GetMaxStep();
+		for (i = 1; i < n; i++)
+		{
+			h_i = coast[i].GetMaxStep();
+			if (abs(h_i) < abs(h))
+			{
+				h = h_i;
+			}
+		}
+		stop = true;
+		for (i = 0; i < n; i++)
+		{
+			if (coast[i].step(h) == false)
+			{
+				stop = false;
+			}
+		}
+	}
+
+	R1.resize(n);
+	V1.resize(n);
+	for (i = 0; i < n; i++)
+	{
+		R1[i] = coast[i].R2;
+		V1[i] = coast[i].V2;
+	}
+}
+
 bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref, OBJHANDLE &gravout)
 {
 	//Temporary
@@ -2102,9 +2356,7 @@ VECTOR3 Vinti(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double mjd0, double dt, int N,
 	double h, rho, error3, mu, max_dr;
 	int nMax, nMax2, n;
 	VECTOR3 Vt1, V1_star, dr2, R2_star, V2_star, R1_ref, V1_ref, R2_ref;
-	VECTOR3 v_l[3][4];
-	VECTOR3 R2l[3][4];
-	VECTOR3 V2l[3][4];
+	std::vector<VECTOR3> v_b(12), R2b(12), V2b(12);
 	VECTOR3 T[3];
 	MATRIX3 T2;
 
@@ -2178,20 +2430,17 @@ VECTOR3 Vinti(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double mjd0, double dt, int N,
 			n += 1;
 			for (int i = 0; i < 4; i++)
 			{
-				v_l[0][i] = V1_star + _V(1, 0, 0)*hvec[i];
-				v_l[1][i] = V1_star + _V(0, 1, 0)*hvec[i];
-				v_l[2][i] = V1_star + _V(0, 0, 1)*hvec[i];
+				v_b[i] = V1_star + _V(1, 0, 0)*hvec[i];
+				v_b[4 + i] = V1_star + _V(0, 1, 0)*hvec[i];
+				v_b[8 + i] = V1_star + _V(0, 0, 1)*hvec[i];
 			}
-			for (int i = 0; i < 3; i++)
+			for (int i = 0; i < 12; i++)
 			{
-				for (int j = 0; j < 4; j++)
-				{
-					rv_from_r0v0_obla(R1, v_l[i][j], mjd0, dt, J2_Earth, mu_Earth, R_Earth, BODY_EARTH, R2l[i][j], V2l[i][j]);
-				}
+				rv_from_r0v0_obla(R1, v_b[i], mjd0, dt, J2_Earth, mu_Earth, R_Earth, BODY_EARTH, R2b[i], V2b[i]);
 			}
 			for (int i = 0; i < 3; i++)
 			{
-				T[i] = (R2l[i][2] - R2l[i][3] - (R2l[i][0] - R2l[i][1])*OrbMech::power(rho, 3.0)) * 1.0 / (rho*h*(1.0 - OrbMech::power(rho, 2.0)));
+				T[i] = (R2b[4 * i + 2] - R2b[4 * i + 3] - (R2b[4 * i] - R2b[4 * i + 1])*OrbMech::power(rho, 3.0)) * 1.0 / (rho*h*(1.0 - OrbMech::power(rho, 2.0)));
 			}
 			T2 = _M(T[0].x, T[1].x, T[2].x, T[0].y, T[1].y, T[2].y, T[0].z, T[1].z, T[2].z);
 			V1_star = V1_star + mul(inverse(T2), dr2);
@@ -2222,20 +2471,15 @@ VECTOR3 Vinti(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double mjd0, double dt, int N,
 		n += 1;
 		for (int i = 0; i < 4; i++)
 		{
-			v_l[0][i] = V1_star + _V(1, 0, 0)*hvec[i];
-			v_l[1][i] = V1_star + _V(0, 1, 0)*hvec[i];
-			v_l[2][i] = V1_star + _V(0, 0, 1)*hvec[i];
+			v_b[i] = V1_star + _V(1, 0, 0)*hvec[i];
+			v_b[4 + i] = V1_star + _V(0, 1, 0)*hvec[i];
+			v_b[8 + i] = V1_star + _V(0, 0, 1)*hvec[i];
 		}
+		//All twelve perturbed trajectories are coasted together
+		oneclickcoast(std::vector<VECTOR3>(12, R1), v_b, mjd0, dt, R2b, V2b, gravin, gravout);
 		for (int i = 0; i < 3; i++)
 		{
-			for (int j = 0; j < 4; j++)
-			{
-				oneclickcoast(R1, v_l[i][j], mjd0, dt, R2l[i][j], V2l[i][j], gravin, gravout);
-			}
-		}
-		for (int i = 0; i < 3; i++)
-		{
-			T[i] = (R2l[i][2] - R2l[i][3] - (R2l[i][0] - R2l[i][1])*OrbMech::power(rho, 3.0)) * 1.0 / (rho*h*(1.0 - OrbMech::power(rho, 2.0)));
+			T[i] = (R2b[4 * i + 2] - R2b[4 * i + 3] - (R2b[4 * i] - R2b[4 * i + 1])*OrbMech::power(rho, 3.0)) * 1.0 / (rho*h*(1.0 - OrbMech::power(rho, 2.0)));
 		}
 		T2 = _M(T[0].x, T[1].x, T[2].x, T[0].y, T[1].y, T[2].y, T[0].z, T[1].z, T[2].z);
 		V1_star = V1_star + mul(inverse(T2), dr2);
@@ -2466,11 +2710,8 @@ double NSRsecant(VECTOR3 RA, VECTOR3 VA, VECTOR3 RP, VECTOR3 VP, double mjd0, do
 	return DH - dh_CDH;
 }
 
-MATRIX3 GetRotationMatrix(int plan, double t)
+static void GetRotationConstants(int plan, double &t0, double &T_p, double &L_0, double &e_rel, double &phi_0, double &T_s, double &e_ref, double &L_ref)
 {
-	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref, L_rel, phi;
-	MATRIX3 Rot1, Rot2, R_ref, Rot3, Rot4, R_rel, R_rot, R, Rot;
-
 	if (plan == BODY_EARTH)
 	{
 		t0 = 51544.5;								//LAN_MJD, MJD of the LAN in the "beginning"
@@ -2493,6 +2734,14 @@ MATRIX3 GetRotationMatrix(int plan, double t)
 		e_ref = 7.259562816e-005;				//Precession Obliquity
 		L_ref = 0.4643456618;					//Precession LAN
 	}
+}
+
+static MATRIX3 GetRotationMatrix_calc(int plan, double t)
+{
+	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref, L_rel, phi;
+	MATRIX3 Rot1, Rot2, R_ref, Rot3, Rot4, R_rel, R_rot, R, Rot;
+
+	GetRotationConstants(plan, t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref);
 
 	Rot1 = _M(cos(L_ref), 0, -sin(L_ref), 0, 1, 0, sin(L_ref), 0, cos(L_ref));
 	Rot2 = _M(1, 0, 0, 0, cos(e_ref), -sin(e_ref), 0, sin(e_ref), cos(e_ref));
@@ -2508,6 +2757,52 @@ MATRIX3 GetRotationMatrix(int plan, double t)
 	return R;
 }
 
+MATRIX3 GetRotationMatrix(int plan, double t)
+{
+	MATRIX3 Rot;
+
+	if (RotationMatrixFromTable(plan, t, Rot))
+	{
+		return Rot;
+	}
+	return GetRotationMatrix_calc(plan, t);
+}
+
+void GetRotationMatrix(int plan, const double *t, unsigned n, MATRIX3 *R)
+{
+	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref, L_rel, phi, cos_e, sin_e, cos_L, sin_L, cos_phi, sin_phi;
+	MATRIX3 Rot1, Rot2, R_ref, Rot;
+
+	GetRotationConstants(plan, t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref);
+
+	//Precession reference and axial tilt don't depend on time
+	Rot1 = _M(cos(L_ref), 0, -sin(L_ref), 0, 1, 0, sin(L_ref), 0, cos(L_ref));
+	Rot2 = _M(1, 0, 0, 0, cos(e_ref), -sin(e_ref), 0, sin(e_ref), cos(e_ref));
+	R_ref = mul(Rot1, Rot2);
+	cos_e = cos(e_rel);
+	sin_e = sin(e_rel);
+
+	for (unsigned i = 0; i < n; i++)
+	{
+		if (RotationMatrixFromTable(plan, t[i], R[i]))
+		{
+			continue;
+		}
+		L_rel = L_0 + PI2*(t[i] - t0) / T_p;
+		phi = phi_0 + PI2*(t[i] - t0) / T_s + (L_0 - L_rel)*cos_e;
+		cos_L = cos(L_rel);
+		sin_L = sin(L_rel);
+		cos_phi = cos(phi);
+		sin_phi = sin(phi);
+
+		//R_rel*R_rot of the single time version, multiplied out
+		Rot = _M(cos_L*cos_phi - sin_L*cos_e*sin_phi, -sin_L*sin_e, -cos_L*sin_phi - sin_L*cos_e*cos_phi,
+			-sin_e*sin_phi, cos_e, -sin_e*cos_phi,
+			sin_L*cos_phi + cos_L*cos_e*sin_phi, cos_L*sin_e, -sin_L*sin_phi + cos_L*cos_e*cos_phi);
+		R[i] = mul(R_ref, Rot);
+	}
+}
+
 /*MATRIX3 GetRotationMatrix2(OBJHANDLE plan, double t)
 {
 	MATRIX3 Ra;
@@ -4278,13 +4573,21 @@ int FindNearestStar(VECTOR3 U_LOS, VECTOR3 R_C, double R_E, double ang_max)
 	double dotpr, last;
 	int star;
 	star = -1;
-	last = -2.0;
+
+	//The occultation check is done for the line of sight, so it is the same for all stars
+	if (!isnotocculted(U_LOS, R_C, R_E))
+	{
+		return star;
+	}
+
+	//Only stars inside the maximum angle
+	last = cos(ang_max);
 
 	for (int i = 0; i < 37; i++)
 	{
 		ustar = navstars[i];
 		dotpr = dotp(ustar, U_LOS);
-		if (dotpr>last && isnotocculted(U_LOS,R_C,R_E) && dotpr>cos(ang_max))
+		if (dotpr>last)
 		{
 			star = i;
 			last = dotpr;
@@ -4854,34 +5157,13 @@ double vektor_max(double* vektor, int n)
 	return max;
 }
 
-MATRIX3 GetObliquityMatrix(int plan, double t)
+static MATRIX3 GetObliquityMatrix_calc(int plan, double t)
 {
 	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref, L_rel, phi, e_ecl, L_ecl;
 	MATRIX3 Rot1, Rot2, Rot3, Rot4, Rot5, Rot6, R_ref, R_rel, R_rot, Rot;
 	VECTOR3 s;
 
-	if (plan == BODY_EARTH)
-	{
-		t0 = 51544.5;								//LAN_MJD, MJD of the LAN in the "beginning"
-		T_p = -9413040.4;							//Precession Period
-		L_0 = 0.00001553343;						//LAN in the "beginning"
-		e_rel = 0.4090928023;						//Obliquity / axial tilt of the earth in radians
-		phi_0 = 4.894942829;						//Sidereal Rotational Offset
-		T_s = 86164.098904 / 24.0 / 60.0 / 60.0;	//Sidereal Rotational Period
-		e_ref = 0;									//Precession Obliquity
-		L_ref = 0;									//Precession LAN
-	}
-	else
-	{
-		t0 = 51544.5;							//LAN_MJD, MJD of the LAN in the "beginning"
-		T_p = -6793.468728092782;				//Precession Period
-		L_0 = 1.71817749;						//LAN in the "beginning"
-		e_rel = 0.026699886264850;				//Obliquity / axial tilt of the earth in radians
-		phi_0 = 4.769465382;					//Sidereal Rotational Offset
-		T_s = 2360588.15 / 24.0 / 60.0 / 60.0;	//Sidereal Rotational Period
-		e_ref = 7.259562816e-005;				//Precession Obliquity
-		L_ref = 0.4643456618;					//Precession LAN
-	}
+	GetRotationConstants(plan, t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref);
 
 	L_rel = L_0 + PI2*(t - t0) / T_p;
 	Rot1 = _M(cos(L_ref), 0.0, -sin(L_ref), 0.0, 1.0, 0.0, sin(L_ref), 0.0, cos(L_ref));
@@ -4901,7 +5183,18 @@ MATRIX3 GetObliquityMatrix(int plan, double t)
 	return mul(Rot5, Rot6);
 }
 
-MATRIX3 J2000EclToBRCS(double mjd)
+MATRIX3 GetObliquityMatrix(int plan, double t)
+{
+	MATRIX3 Rot;
+
+	if (ObliquityMatrixFromTable(plan, t, Rot))
+	{
+		return Rot;
+	}
+	return GetObliquityMatrix_calc(plan, t);
+}
+
+static MATRIX3 J2000EclToBRCS_calc(double mjd)
 {
 	double t1 = (mjd - 51544.5) / 36525.0;
 	double t2 = t1*t1;
@@ -4923,6 +5216,257 @@ MATRIX3 J2000EclToBRCS(double mjd)
 	return mul(mul(_MRz(rot), _MRx(inc)), mul(_MRz(lan), _MRx(-obl)));
 }
 
+MATRIX3 J2000EclToBRCS(double mjd)
+{
+	MATRIX3 Rot;
+
+	if (J2000EclToBRCSFromTable(mjd, Rot))
+	{
+		return Rot;
+	}
+	return J2000EclToBRCS_calc(mjd);
+}
+
+//Nodes of the matrix table
+static const double MatrixTableDays = 90.0;
+static const double RotationTableStep = 1.0 / 24.0;	//Rotation angles every hour
+static const double ObliquityTableStep = 0.1;			//Obliquity and J2000 matrices every 0.1 days
+//Largest difference of a matrix element to the direct calculation that the table may have
+static const double MatrixTableTolerance = 1e-9;
+
+//Matrices of a mission time window. A table isn't changed after it is published, so threads can use it without locking.
+struct MatrixTable
+{
+	double MJD0;
+	int NumRot, NumObl;
+	//Per body
+	MATRIX3 R_ref[2];
+	double cos_e[2], sin_e[2];
+	double dL[2], dphi[2];					//Rate of L_rel and phi, rad/day
+	std::vector<double> cos_L[2], sin_L[2], cos_phi[2], sin_phi[2];
+	std::vector<MATRIX3> obl[2];
+	std::vector<MATRIX3> j2000;
+	//False if the check against the direct calculation failed, those matrices are then calculated directly
+	bool rot_ok[2], obl_ok[2], j2000_ok;
+};
+
+static MatrixTable * volatile matrixTable = NULL;
+//Replaced tables, another thread might still be reading them
+static std::vector<MatrixTable*> matrixTablesRetired;
+static Mutex matrixTableMutex;
+
+//cos and sin of a + d from cos and sin of a, for small d
+static inline void MatrixTableAngle(double cos_a, double sin_a, double d, double &c, double &s)
+{
+	double d2 = d*d;
+	double cos_d = 1.0 - d2 / 2.0*(1.0 - d2 / 12.0*(1.0 - d2 / 30.0*(1.0 - d2 / 56.0)));
+	double sin_d = d*(1.0 - d2 / 6.0*(1.0 - d2 / 20.0*(1.0 - d2 / 42.0*(1.0 - d2 / 72.0))));
+
+	c = cos_a*cos_d - sin_a*sin_d;
+	s = sin_a*cos_d + cos_a*sin_d;
+}
+
+//Quadratic interpolation between the node nearest to x and its neighbors
+static inline MATRIX3 MatrixTableInterpolate(const std::vector<MATRIX3> &m, double x)
+{
+	int k = (int)(x + 0.5);
+	double u, a, b;
+	MATRIX3 R;
+
+	if (k < 1) k = 1;
+	if (k > (int)m.size() - 2) k = (int)m.size() - 2;
+	u = x - (double)k;
+	a = u*(u - 1.0) / 2.0;
+	b = u*(u + 1.0) / 2.0;
+	for (int i = 0; i < 9; i++)
+	{
+		R.data[i] = a*m[k - 1].data[i] + (1.0 - u*u)*m[k].data[i] + b*m[k + 1].data[i];
+	}
+	return R;
+}
+
+static bool RotationMatrixFromTable(const MatrixTable *tab, int plan, double t, MATRIX3 &R)
+{
+	double x, dt, cos_L, sin_L, cos_phi, sin_phi, cos_e, sin_e;
+	int k;
+
+	x = (t - tab->MJD0) / RotationTableStep;
+	if (!tab->rot_ok[plan] || !(x >= 0.0 && x <= (double)(tab->NumRot - 1)))
+	{
+		return false;
+	}
+	k = (int)(x + 0.5);
+	dt = t - (tab->MJD0 + (double)k*RotationTableStep);
+	MatrixTableAngle(tab->cos_L[plan][k], tab->sin_L[plan][k], tab->dL[plan] * dt, cos_L, sin_L);
+	MatrixTableAngle(tab->cos_phi[plan][k], tab->sin_phi[plan][k], tab->dphi[plan] * dt, cos_phi, sin_phi);
+	cos_e = tab->cos_e[plan];
+	sin_e = tab->sin_e[plan];
+
+	//R_rel*R_rot of the single time version, multiplied out
+	R = mul(tab->R_ref[plan], _M(cos_L*cos_phi - sin_L*cos_e*sin_phi, -sin_L*sin_e, -cos_L*sin_phi - sin_L*cos_e*cos_phi,
+		-sin_e*sin_phi, cos_e, -sin_e*cos_phi,
+		sin_L*cos_phi + cos_L*cos_e*sin_phi, cos_L*sin_e, -sin_L*sin_phi + cos_L*cos_e*cos_phi));
+	return true;
+}
+
+static bool RotationMatrixFromTable(int plan, double t, MATRIX3 &R)
+{
+	const MatrixTable *tab = matrixTable;
+
+	return tab && (plan == BODY_EARTH || plan == BODY_MOON) && RotationMatrixFromTable(tab, plan, t, R);
+}
+
+static bool ObliquityMatrixFromTable(const MatrixTable *tab, int plan, double t, MATRIX3 &R)
+{
+	double x = (t - tab->MJD0) / ObliquityTableStep;
+
+	if (!tab->obl_ok[plan] || !(x >= 0.0 && x <= (double)(tab->NumObl - 1)))
+	{
+		return false;
+	}
+	R = MatrixTableInterpolate(tab->obl[plan], x);
+	return true;
+}
+
+static bool ObliquityMatrixFromTable(int plan, double t, MATRIX3 &R)
+{
+	const MatrixTable *tab = matrixTable;
+
+	return tab && (plan == BODY_EARTH || plan == BODY_MOON) && ObliquityMatrixFromTable(tab, plan, t, R);
+}
+
+static bool J2000EclToBRCSFromTable(const MatrixTable *tab, double mjd, MATRIX3 &R)
+{
+	double x = (mjd - tab->MJD0) / ObliquityTableStep;
+
+	if (!tab->j2000_ok || !(x >= 0.0 && x <= (double)(tab->NumObl - 1)))
+	{
+		return false;
+	}
+	R = MatrixTableInterpolate(tab->j2000, x);
+	return true;
+}
+
+static bool J2000EclToBRCSFromTable(double mjd, MATRIX3 &R)
+{
+	const MatrixTable *tab = matrixTable;
+
+	return tab && J2000EclToBRCSFromTable(tab, mjd, R);
+}
+
+//Raises err to the largest element difference of the two matrices
+static void MatrixTableError(const MATRIX3 &A, const MATRIX3 &B, double &err)
+{
+	for (int i = 0; i < 9; i++)
+	{
+		if (fabs(A.data[i] - B.data[i]) > err)
+		{
+			err = fabs(A.data[i] - B.data[i]);
+		}
+	}
+}
+
+void SetMatrixTableWindow(double MJD)
+{
+	double t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref, L_rel, phi, t, err;
+	MatrixTable *tab;
+	MATRIX3 R;
+
+	if (MJD <= 0.0)
+	{
+		return;
+	}
+
+	Lock lock(matrixTableMutex);
+
+	//Whole days, so that the nodes are the same for any time of the launch day
+	MJD = floor(MJD) - 1.0;
+	if (matrixTable && matrixTable->MJD0 == MJD)
+	{
+		return;
+	}
+
+	tab = new MatrixTable;
+	tab->MJD0 = MJD;
+	tab->NumRot = (int)(MatrixTableDays / RotationTableStep + 0.5) + 1;
+	tab->NumObl = (int)(MatrixTableDays / ObliquityTableStep + 0.5) + 1;
+
+	for (int plan = 0; plan < 2; plan++)
+	{
+		GetRotationConstants(plan, t0, T_p, L_0, e_rel, phi_0, T_s, e_ref, L_ref);
+		tab->R_ref[plan] = mul(_M(cos(L_ref), 0, -sin(L_ref), 0, 1, 0, sin(L_ref), 0, cos(L_ref)), _M(1, 0, 0, 0, cos(e_ref), -sin(e_ref), 0, sin(e_ref), cos(e_ref)));
+		tab->cos_e[plan] = cos(e_rel);
+		tab->sin_e[plan] = sin(e_rel);
+		tab->dL[plan] = PI2 / T_p;
+		tab->dphi[plan] = PI2 / T_s - PI2 / T_p*cos(e_rel);
+
+		tab->cos_L[plan].resize(tab->NumRot);
+		tab->sin_L[plan].resize(tab->NumRot);
+		tab->cos_phi[plan].resize(tab->NumRot);
+		tab->sin_phi[plan].resize(tab->NumRot);
+		for (int k = 0; k < tab->NumRot; k++)
+		{
+			t = MJD + (double)k*RotationTableStep;
+			L_rel = L_0 + PI2*(t - t0) / T_p;
+			phi = phi_0 + PI2*(t - t0) / T_s + (L_0 - L_rel)*cos(e_rel);
+			tab->cos_L[plan][k] = cos(L_rel);
+			tab->sin_L[plan][k] = sin(L_rel);
+			tab->cos_phi[plan][k] = cos(phi);
+			tab->sin_phi[plan][k] = sin(phi);
+		}
+
+		tab->obl[plan].resize(tab->NumObl);
+		for (int k = 0; k < tab->NumObl; k++)
+		{
+			tab->obl[plan][k] = GetObliquityMatrix_calc(plan, MJD + (double)k*ObliquityTableStep);
+		}
+	}
+	tab->j2000.resize(tab->NumObl);
+	for (int k = 0; k < tab->NumObl; k++)
+	{
+		tab->j2000[k] = J2000EclToBRCS_calc(MJD + (double)k*ObliquityTableStep);
+	}
+
+	//Check against the direct calculation between the nodes, where the table is least accurate
+	tab->j2000_ok = true;
+	for (int plan = 0; plan < 2; plan++)
+	{
+		tab->rot_ok[plan] = tab->obl_ok[plan] = true;
+		err = 0.0;
+		for (int k = 0; k < tab->NumRot - 1; k++)
+		{
+			t = MJD + ((double)k + 0.5)*RotationTableStep;
+			RotationMatrixFromTable(tab, plan, t, R);
+			MatrixTableError(R, GetRotationMatrix_calc(plan, t), err);
+		}
+		tab->rot_ok[plan] = err <= MatrixTableTolerance;
+		err = 0.0;
+		for (int k = 0; k < tab->NumObl - 1; k++)
+		{
+			t = MJD + ((double)k + 0.5)*ObliquityTableStep;
+			ObliquityMatrixFromTable(tab, plan, t, R);
+			MatrixTableError(R, GetObliquityMatrix_calc(plan, t), err);
+		}
+		//Also fails if the ecliptic longitude of the pole wraps around inside of the window
+		tab->obl_ok[plan] = err <= MatrixTableTolerance;
+	}
+	err = 0.0;
+	for (int k = 0; k < tab->NumObl - 1; k++)
+	{
+		t = MJD + ((double)k + 0.5)*ObliquityTableStep;
+		J2000EclToBRCSFromTable(tab, t, R);
+		MatrixTableError(R, J2000EclToBRCS_calc(t), err);
+	}
+	tab->j2000_ok = err <= MatrixTableTolerance;
+
+	MatrixTable *old = matrixTable;
+	if (old)
+	{
+		matrixTablesRetired.push_back(old);
+	}
+	InterlockedExchangePointer((PVOID volatile *)&matrixTable, tab);
+}
+
 MATRIX3 _MRx(double a)
 {
 	double ca = cos(a), sa = sin(a);
@@ -8793,11 +9337,70 @@ NewPMMLAEG_V846:
 	goto NewPMMLAEG_V305;
 }
 
+CoastEphemerisCache::CoastEphemerisCache()
+{
+	for (int i = 0; i < MoonEntries; i++)
+	{
+		MoonMJD[i] = -1.0;
+	}
+	MoonNext = 0;
+	SunInit = false;
+	SunMJD = 0.0;
+	SunR_ES0 = SunV_ES0 = _V(0, 0, 0);
+	SunW_ES = 0.0;
+}
+
+void CoastEphemerisCache::MoonEphemeris(CELBODY *cMoon, double MJD, double *MoonPos)
+{
+	int i;
+
+	for (i = 0; i < MoonEntries; i++)
+	{
+		if (MoonMJD[i] == MJD)
+		{
+			break;
+		}
+	}
+	if (i == MoonEntries)
+	{
+		i = MoonNext;
+		MoonNext = (MoonNext + 1) % MoonEntries;
+		cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonData[i]);
+		MoonMJD[i] = MJD;
+	}
+	for (int j = 0; j < 6; j++)
+	{
+		MoonPos[j] = MoonData[i][j];
+	}
+}
+
+bool CoastEphemerisCache::GetSolarEphemeris(double MJD, VECTOR3 &R_ES0, VECTOR3 &V_ES0, double &W_ES)
+{
+	if (SunInit == false || SunMJD != MJD)
+	{
+		return false;
+	}
+	R_ES0 = SunR_ES0;
+	V_ES0 = SunV_ES0;
+	W_ES = SunW_ES;
+	return true;
+}
+
+void CoastEphemerisCache::SetSolarEphemeris(double MJD, VECTOR3 R_ES0, VECTOR3 V_ES0, double W_ES)
+{
+	SunMJD = MJD;
+	SunR_ES0 = R_ES0;
+	SunV_ES0 = V_ES0;
+	SunW_ES = W_ES;
+	SunInit = true;
+}
+
 const double CoastIntegrator::r_SPH = 64373760.0;
 
-CoastIntegrator::CoastIntegrator(VECTOR3 R00, VECTOR3 V00, double mjd0, double deltat, int planet, int outplanet)
+CoastIntegrator::CoastIntegrator(VECTOR3 R00, VECTOR3 V00, double mjd0, double deltat, int planet, int outplanet, CoastEphemerisCache *ephem)
 {
 	this->outplanet = outplanet;
+	this->ephem = ephem;
 
 	K = 0.3;
 	dt_lim = 4000;
@@ -8888,11 +9491,13 @@ int CoastIntegrator::GetGravRef()
 
 bool CoastIntegrator::iteration(bool allow_stop)
 {
-	double rr, dt_max, dt, h, x_apo, gamma, s, alpha_N, x_t, Y, r_qc;
-	VECTOR3 alpha, R_apo, V_apo, R, a_d, ff;
-	VECTOR3 k[3];
+	return step(GetMaxStep(), allow_stop);
+}
+
+double CoastIntegrator::GetMaxStep()
+{
+	double rr, dt_max, Y, r_qc;
 
-	R = R_CON;
 	rr = length(R_CON);
 	r_qc = length(R_QC);
 	if (rr < r_MP)
@@ -8905,7 +9510,25 @@ bool CoastIntegrator::iteration(bool allow_stop)
 	}
 	dt_max = 0.3*min(dt_lim, min(K*OrbMech::power(rr, 1.5) / sqrt(mu), (M == 0 ? 10e10 : K * OrbMech::power(r_qc, 1.5) / sqrt(mu_Q))));
 	Y = OrbMech::sign(t_F - t);
-	dt = Y*min(abs(t_F - t), dt_max);
+	return Y*min(abs(t_F - t), dt_max);
+}
+
+bool CoastIntegrator::step(double dt, bool allow_stop)
+{
+	double rr, h, x_apo, gamma, s, alpha_N, x_t;
+	VECTOR3 alpha, R_apo, V_apo, R, a_d, ff;
+	VECTOR3 k[3];
+
+	R = R_CON;
+	rr = length(R_CON);
+	if (rr < r_MP)
+	{
+		M = 0;
+	}
+	else
+	{
+		M = 1;
+	}
 
 	if (M == 1)
 	{
@@ -8917,7 +9540,7 @@ bool CoastIntegrator::iteration(bool allow_stop)
 				VECTOR3 R_EM, V_PQ;
 
 				MJD = mjd0 + t / 86400.0;
-				cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
+				MoonEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
 
 				if (B == 1)
 				{
@@ -8954,7 +9577,7 @@ bool CoastIntegrator::iteration(bool allow_stop)
 			VECTOR3 R_EM, V_PQ;
 
 			MJD = mjd0 + t / 86400.0;
-			cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
+			MoonEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
 
 			if (B == 1)
 			{
@@ -9042,7 +9665,7 @@ bool CoastIntegrator::iteration(bool allow_stop)
 			VECTOR3 R_EM, V_PQ, V_EM;
 
 			MJD = mjd0 + t / 86400.0;
-			cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
+			MoonEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, MoonPos);
 
 			R_EM = _V(MoonPos[0], MoonPos[2], MoonPos[1]);
 			V_EM = _V(MoonPos[3], MoonPos[5], MoonPos[4]);
@@ -9071,16 +9694,26 @@ void CoastIntegrator::SolarEphemeris(double t, VECTOR3 &R_ES, VECTOR3 &V_ES)
 {
 	if (SunEphemerisInit == false)
 	{
-		double EarthPos[12];
-		VECTOR3 EarthVec, EarthVecVel;
+		double MJD = mjd0 + t_F / 2.0 / 24.0 / 3600.0;
+
+		if (ephem == NULL || ephem->GetSolarEphemeris(MJD, R_ES0, V_ES0, W_ES) == false)
+		{
+			double EarthPos[12];
+			VECTOR3 EarthVec, EarthVecVel;
+
+			cEarth->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
 
-		cEarth->clbkEphemeris(mjd0 + t_F / 2.0 / 24.0 / 3600.0, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
+			EarthVec = OrbMech::Polar2Cartesian(EarthPos[2] * AU, EarthPos[1], EarthPos[0]);
+			EarthVecVel = OrbMech::Polar2CartesianVel(EarthPos[2] * AU, EarthPos[1], EarthPos[0], EarthPos[5] * AU, EarthPos[4], EarthPos[3]);
+			R_ES0 = -EarthVec;
+			V_ES0 = -EarthVecVel;
+			W_ES = length(crossp(R_ES0, V_ES0) / OrbMech::power(length(R_ES0), 2.0));
 
-		EarthVec = OrbMech::Polar2Cartesian(EarthPos[2] * AU, EarthPos[1], EarthPos[0]);
-		EarthVecVel = OrbMech::Polar2CartesianVel(EarthPos[2] * AU, EarthPos[1], EarthPos[0], EarthPos[5] * AU, EarthPos[4], EarthPos[3]);
-		R_ES0 = -EarthVec;
-		V_ES0 = -EarthVecVel;
-		W_ES = length(crossp(R_ES0, V_ES0) / OrbMech::power(length(R_ES0), 2.0));
+			if (ephem)
+			{
+				ephem->SetSolarEphemeris(MJD, R_ES0, V_ES0, W_ES);
+			}
+		}
 		SunEphemerisInit = true;
 	}
 
@@ -9088,6 +9721,18 @@ void CoastIntegrator::SolarEphemeris(double t, VECTOR3 &R_ES, VECTOR3 &V_ES)
 	V_ES = V_ES0;
 }
 
+void CoastIntegrator::MoonEphemeris(double MJD, int req, double *MoonPos)
+{
+	if (ephem)
+	{
+		ephem->MoonEphemeris(cMoon, MJD, MoonPos);
+	}
+	else
+	{
+		cMoon->clbkEphemeris(MJD, req, MoonPos);
+	}
+}
+
 VECTOR3 CoastIntegrator::f(VECTOR3 alpha, VECTOR3 R, VECTOR3 a_d)
 {
 	VECTOR3 R_CON;
@@ -9147,7 +9792,7 @@ VECTOR3 CoastIntegrator::adfunc(VECTOR3 R)
 
 		MJD = mjd0 + t / 86400.0;
 
-		cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS, MoonPos);
+		MoonEphemeris(MJD, EPHEM_TRUEPOS, MoonPos);
 		SolarEphemeris(t - t_F/2.0, R_ES, V_ES);
 		R_EM = _V(MoonPos[0], MoonPos[2], MoonPos[1]);
 
@@ -338,12 +338,36 @@ protected:
 	AEGDataBlock CurrentBlock;
 };
 
+//Moon and Sun ephemeris shared by a set of CoastIntegrators that are propagated in lockstep
+class CoastEphemerisCache
+{
+public:
+	CoastEphemerisCache();
+	void MoonEphemeris(CELBODY *cMoon, double MJD, double *MoonPos);
+	bool GetSolarEphemeris(double MJD, VECTOR3 &R_ES0, VECTOR3 &V_ES0, double &W_ES);
+	void SetSolarEphemeris(double MJD, VECTOR3 R_ES0, VECTOR3 V_ES0, double W_ES);
+private:
+	//Each integration step needs the Moon at the start, middle and end of the step
+	static const int MoonEntries = 4;
+	double MoonMJD[MoonEntries];
+	double MoonData[MoonEntries][6];
+	int MoonNext;
+	bool SunInit;
+	double SunMJD;
+	VECTOR3 SunR_ES0, SunV_ES0;
+	double SunW_ES;
+};
+
 class CoastIntegrator
 {
 public:
-	CoastIntegrator(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, int planet, int outplanet);
+	CoastIntegrator(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, int planet, int outplanet, CoastEphemerisCache *ephem = NULL);
 	~CoastIntegrator();
 	bool iteration(bool allow_stop = true);
+	//Step size the integrator would choose for the next iteration
+	double GetMaxStep();
+	//Iteration with an externally chosen step size, not larger than GetMaxStep()
+	bool step(double dt, bool allow_stop = true);
 
 	void AdjustTF(double t_f) { t_F = t_f; }
 
@@ -361,6 +385,7 @@ private:
 	double fq(double q);
 	VECTOR3 adfunc(VECTOR3 R);
 	void SolarEphemeris(double t, VECTOR3 &R_ES, VECTOR3 &V_ES);
+	void MoonEphemeris(double MJD, int req, double *MoonPos);
 
 	double R_E, mu;
 	double K, dt_lim;
@@ -382,6 +407,7 @@ private:
 	double W_ES;
 	static const double r_SPH;
 	bool SunEphemerisInit;
+	CoastEphemerisCache *ephem;
 };
 
 namespace OrbMech {
@@ -400,6 +426,46 @@ namespace OrbMech {
 	const double J5_Earth = -0.15e-6;
 	const double J2_Moon = 207.108e-6;
 
+	//Conic primitives served by the result cache
+	enum ConicCacheType
+	{
+		CONIC_CACHE_KEPLER_E,
+		CONIC_CACHE_LAMBERT,
+		CONIC_CACHE_TIME_THETA,
+		CONIC_CACHE_RV_TA,
+		CONIC_CACHE_NUM
+	};
+
+	struct ConicCacheStatistics
+	{
+		unsigned long long Hits[CONIC_CACHE_NUM] = {};
+		unsigned long long Misses[CONIC_CACHE_NUM] = {};
+	};
+
+	//Opt-in, per thread cache of kepler_E, elegant_lambert, time_theta and rv_from_r0v0_ta results. Calls nest, the cache is freed when the last user disables it
+	void EnableConicCache(bool enable);
+	//Hit and miss counters of the calling thread's cache, false if it is disabled
+	bool GetConicCacheStatistics(ConicCacheStatistics &stats);
+
+	//A cache that is kept by its owner instead of the thread, so that its results survive from one calculation thread to the next.
+	//Only one thread at a time may have it attached. Nested EnableConicCache calls on that thread use it as well.
+	struct ConicCache;
+	ConicCache *CreateConicCache();
+	void DeleteConicCache(ConicCache *cache);
+	//Makes the cache the one of the calling thread, NULL detaches it again
+	void AttachConicCache(ConicCache *cache);
+
+	//Enables the conic cache of the calling thread while in scope, either a new one or the given cache that is kept by the caller
+	class ConicCacheScope
+	{
+	public:
+		ConicCacheScope() : shared(NULL) { EnableConicCache(true); }
+		ConicCacheScope(ConicCache *cache) : shared(cache) { AttachConicCache(cache); }
+		~ConicCacheScope() { if (shared) AttachConicCache(NULL); else EnableConicCache(false); }
+	private:
+		ConicCache *shared;
+	};
+
 	void rv_from_r0v0_obla(VECTOR3 R1, VECTOR3 V1, double MJD, double dt, double J2, double mu, double R_E, int P, VECTOR3 &R2, VECTOR3 &V2);
 	double kepler_E(double e, double M, double error2 = 1.e-8);
 	double kepler_H(double e, double M);
@@ -451,6 +517,11 @@ namespace OrbMech {
 	void ReturnPerigeeConic(VECTOR3 R, VECTOR3 V, double mjd0, OBJHANDLE hMoon, OBJHANDLE hEarth, double &MJD_peri, VECTOR3 &R_peri, VECTOR3 &V_peri);
 	double PATCH(VECTOR3 R, VECTOR3 V, double mjd0, bool earthsoi, VECTOR3 &R3, VECTOR3 &V3, bool Q = true);
 	MATRIX3 GetRotationMatrix(int plan, double t);
+	//Rotation matrices for n times, only the time dependent angles are evaluated per time
+	void GetRotationMatrix(int plan, const double *t, unsigned n, MATRIX3 *R);
+	//Precomputes the GetRotationMatrix, GetObliquityMatrix and J2000EclToBRCS matrices of Earth and Moon for the 90 days starting one day before the given MJD.
+	//Times inside of the window are then looked up in the table by all threads, all other times are still calculated directly.
+	void SetMatrixTableWindow(double MJD);
 	MATRIX3 Orbiter2PACSS13(double mjd, double lat, double lng, double azi);
 	void PACSS4_from_coe(OELEMENTS coe, double mu, VECTOR3 &R, VECTOR3 &V);
 	void PACSS13_from_coe(OELEMENTS coe, double lat, double A_Z, double mu, VECTOR3 &R_S, VECTOR3 &V_S);
@@ -478,6 +549,8 @@ namespace OrbMech {
 	//int rkf45(double*, double**, double*, double*, int, double tol = 1e-15);
 	bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, OBJHANDLE gravref, OBJHANDLE &gravout);
 	bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, int gravref, int &gravout);
+	//Coasts several state vectors with a common epoch in lockstep. gravout = -1 returns the state vectors relative to gravref
+	void oneclickcoast(const std::vector<VECTOR3> &R0, const std::vector<VECTOR3> &V0, double mjd0, double dt, std::vector<VECTOR3> &R1, std::vector<VECTOR3> &V1, int gravref, int gravout);
 	SV coast(SV sv0, double dt);
 	MPTSV coast(MPTSV sv0, double dt);
 	void PMMCEN(PMMCEN_VNI VNI, PMMCEN_INI INI, VECTOR3 &R1, VECTOR3 &V1, double &T1, int &ITS, int &IRS);
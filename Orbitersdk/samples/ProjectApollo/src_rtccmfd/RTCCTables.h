@@ -75,6 +75,8 @@ struct RTCCNIInputTable
 	double WDMULT = 1.0;
 	//Word 10, density multiplier
 	double DENSMULT = 1.0;
+	//Thrust multiplier (normally 1.0), weight loss rate is scaled with it
+	double THRMULT = 1.0;
 	//Word 11 (Bytes 1,2), ephemeris output option: 0 for none, 1 for R and V, 2 for R and V and weights
 	int IEPHOP = 0;
 	//Word 11 (Bytes 3,4), auxiliary output option (false = table not desired, true = table desired)
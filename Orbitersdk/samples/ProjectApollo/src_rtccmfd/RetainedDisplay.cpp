@@ -0,0 +1,109 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC MFD Retained Display Page
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "Orbitersdk.h"
+#include "RetainedDisplay.h"
+
+RetainedDisplay::RetainedDisplay()
+{
+	valid = false;
+	page = 0;
+	version = 0;
+	option = 0;
+}
+
+bool RetainedDisplay::Record(int p, unsigned v, int opt)
+{
+	if (valid && page == p && version == v && option == opt)
+	{
+		return false;
+	}
+
+	items.clear();
+	valid = true;
+	page = p;
+	version = v;
+	option = opt;
+	return true;
+}
+
+void RetainedDisplay::Invalidate()
+{
+	valid = false;
+	items.clear();
+}
+
+void RetainedDisplay::Draw(oapi::Sketchpad *skp) const
+{
+	for (unsigned i = 0;i < items.size();i++)
+	{
+		const Item &item = items[i];
+
+		if (item.type == 0)
+		{
+			skp->Text(item.x, item.y, item.text.c_str(), item.text.length());
+		}
+		else if (item.type == 1)
+		{
+			skp->SetFont(item.font);
+		}
+		else
+		{
+			skp->SetTextAlign(item.tah, item.tav);
+		}
+	}
+}
+
+void RetainedDisplay::Text(int x, int y, const char *str, int len)
+{
+	Item item;
+
+	//Some pages pass a shorter length than the string to cut it off
+	int n = 0;
+	while (n < len && str[n]) n++;
+
+	item.type = 0;
+	item.x = x;
+	item.y = y;
+	item.text.assign(str, n);
+	items.push_back(item);
+}
+
+void RetainedDisplay::SetFont(oapi::Font *font)
+{
+	Item item;
+
+	item.type = 1;
+	item.font = font;
+	items.push_back(item);
+}
+
+void RetainedDisplay::SetTextAlign(oapi::Sketchpad::TAlign_horizontal tah, oapi::Sketchpad::TAlign_vertical tav)
+{
+	Item item;
+
+	item.type = 2;
+	item.tah = tah;
+	item.tav = tav;
+	items.push_back(item);
+}
@@ -0,0 +1,64 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+RTCC MFD Retained Display Page (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <string>
+
+//Display page that is formatted once and then drawn from the recorded text on every MFD refresh.
+//The page is recorded again when the page number, the version of its source table or the display option changes.
+//The recording functions have the same names as the oapi::Sketchpad functions, so the page code can be written as usual.
+class RetainedDisplay
+{
+public:
+	RetainedDisplay();
+
+	//Returns true if the page has to be recorded, the old recording is cleared then
+	bool Record(int page, unsigned version, int option = 0);
+	void Invalidate();
+	//Draws the recorded page
+	void Draw(oapi::Sketchpad *skp) const;
+
+	void Text(int x, int y, const char *str, int len);
+	void SetFont(oapi::Font *font);
+	void SetTextAlign(oapi::Sketchpad::TAlign_horizontal tah = oapi::Sketchpad::LEFT, oapi::Sketchpad::TAlign_vertical tav = oapi::Sketchpad::TOP);
+
+protected:
+	struct Item
+	{
+		//0 = Text, 1 = Font, 2 = Text alignment
+		int type;
+		int x, y;
+		std::string text;
+		oapi::Font *font;
+		oapi::Sketchpad::TAlign_horizontal tah;
+		oapi::Sketchpad::TAlign_vertical tav;
+	};
+
+	std::vector<Item> items;
+	bool valid;
+	int page;
+	unsigned version;
+	int option;
+};
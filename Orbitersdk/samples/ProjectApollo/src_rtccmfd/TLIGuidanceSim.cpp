@@ -203,6 +203,15 @@ void TLIGuidanceSim::PCMTRL()
 		WTFLO[4] = rtcc->MCTJWH;
 	}
 
+	if (TABLIN.THRMULT != 1.0)
+	{
+		for (int i = 0;i < 7;i++)
+		{
+			FORCE[i] *= TABLIN.THRMULT;
+			WTFLO[i] *= TABLIN.THRMULT;
+		}
+	}
+
 	//Ephemeris storage initialization
 	if (KEHOP != 0)
 	{
@@ -0,0 +1,124 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Vessel states published for the RTCC calculation threads
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "Orbitersdk.h"
+#include "VesselStates.h"
+
+VesselStates::Slot VesselStates::slots[VesselStates::MaxSlots];
+volatile double VesselStates::LatestMJD = 0.0;
+
+void VesselStates::Publish(VESSEL *v)
+{
+	if (v == NULL) return;
+
+	VesselState state;
+	int i, free = -1, oldest = 0;
+
+	state.MJD = oapiGetSimMJD();
+
+	for (i = 0;i < MaxSlots;i++)
+	{
+		if (slots[i].vessel == v)
+		{
+			//Already published in this time step
+			if (slots[i].state.MJD == state.MJD) return;
+			break;
+		}
+		if (slots[i].vessel == NULL)
+		{
+			if (free < 0) free = i;
+		}
+		else if (slots[i].state.MJD < slots[oldest].state.MJD)
+		{
+			oldest = i;
+		}
+	}
+	if (i == MaxSlots)
+	{
+		//New vessel, the slot of the vessel that wasn't published for the longest time is reused if all are taken
+		i = free >= 0 ? free : oldest;
+	}
+
+	state.vessel = v;
+	state.hEarth = oapiGetObjectByName("Earth");
+	state.hMoon = oapiGetObjectByName("Moon");
+	v->GetRelativePos(state.hEarth, state.R_Earth);
+	v->GetRelativeVel(state.hEarth, state.V_Earth);
+	v->GetRelativePos(state.hMoon, state.R_Moon);
+	v->GetRelativeVel(state.hMoon, state.V_Moon);
+	state.mass = v->GetMass();
+
+	Write(slots[i], state);
+	LatestMJD = state.MJD;
+}
+
+void VesselStates::Remove(VESSEL *v)
+{
+	for (int i = 0;i < MaxSlots;i++)
+	{
+		if (slots[i].vessel == v)
+		{
+			Write(slots[i], VesselState());
+		}
+	}
+}
+
+void VesselStates::Clear()
+{
+	for (int i = 0;i < MaxSlots;i++)
+	{
+		Write(slots[i], VesselState());
+	}
+	LatestMJD = 0.0;
+}
+
+bool VesselStates::Get(VESSEL *v, VesselState &state)
+{
+	if (v == NULL) return false;
+
+	for (int i = 0;i < MaxSlots;i++)
+	{
+		if (slots[i].vessel != v) continue;
+
+		LONG seq;
+		do
+		{
+			seq = slots[i].seq;
+			MemoryBarrier();
+			state = slots[i].state;
+			MemoryBarrier();
+		} while ((seq & 1) || seq != slots[i].seq);
+
+		//The slot could have been given to another vessel in the meantime
+		return state.vessel == v && state.MJD == LatestMJD;
+	}
+	return false;
+}
+
+void VesselStates::Write(Slot &slot, const VesselState &state)
+{
+	InterlockedIncrement(&slot.seq);
+	slot.state = state;
+	slot.vessel = state.vessel;
+	InterlockedIncrement(&slot.seq);
+}
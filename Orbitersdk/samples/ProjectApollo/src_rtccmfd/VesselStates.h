@@ -0,0 +1,71 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Vessel states published for the RTCC calculation threads (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+//State of a vessel at the end of a time step. Vectors are in the left-handed Orbiter frame, as returned by GetRelativePos/Vel.
+struct VesselState
+{
+	VESSEL *vessel = NULL;
+	//Position and velocity relative to the Earth
+	VECTOR3 R_Earth = _V(0, 0, 0);
+	VECTOR3 V_Earth = _V(0, 0, 0);
+	//Position and velocity relative to the Moon
+	VECTOR3 R_Moon = _V(0, 0, 0);
+	VECTOR3 V_Moon = _V(0, 0, 0);
+	OBJHANDLE hEarth = NULL;
+	OBJHANDLE hMoon = NULL;
+	double MJD = 0.0;
+	double mass = 0.0;
+};
+
+//The Orbiter API may only be used on the main thread. The RTCC MFD publishes the states of the vessels it works with once per
+//time step, so the calculation threads can read them instead. Each slot is protected by a sequence counter: the writer makes it
+//odd while it copies the state, a reader repeats its copy when the counter was odd or has changed in between. Neither side waits.
+class VesselStates
+{
+public:
+	//Main thread only
+	static void Publish(VESSEL *v);
+	static void Remove(VESSEL *v);
+	static void Clear();
+	//Any thread. False if the vessel has no state of the latest time step, the caller has to use the Orbiter API then.
+	static bool Get(VESSEL *v, VesselState &state);
+
+protected:
+	struct Slot
+	{
+		Slot() : seq(0), vessel(NULL) {};
+
+		volatile LONG seq;
+		VESSEL * volatile vessel;
+		VesselState state;
+	};
+
+	static void Write(Slot &slot, const VesselState &state);
+
+	static const int MaxSlots = 32;
+	static Slot slots[MaxSlots];
+	//Time of the newest published state
+	static volatile double LatestMJD;
+};
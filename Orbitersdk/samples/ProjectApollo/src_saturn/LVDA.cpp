@@ -33,6 +33,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "iu.h"
 #include "saturn.h"
 #include "papi.h"
+#include "NamedObjects.h"
 
 #include "LVDA.h"
 
@@ -325,12 +326,12 @@ int LVDA::GetVehicleNo()
 
 void LVDA::GetRelativePos(VECTOR3 &v)
 {
-	iu->GetLVCommandConnector()->GetRelativePos(oapiGetObjectByName("Earth"), v);
+	iu->GetLVCommandConnector()->GetRelativePos(NamedObjects::Earth(), v);
 }
 
 void LVDA::GetRelativeVel(VECTOR3 &v)
 {
-	iu->GetLVCommandConnector()->GetRelativeVel(oapiGetObjectByName("Earth"), v);
+	iu->GetLVCommandConnector()->GetRelativeVel(NamedObjects::Earth(), v);
 }
 
 bool LVDA::GetSCControlPoweredFlight()
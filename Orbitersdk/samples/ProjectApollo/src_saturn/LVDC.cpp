@@ -528,13 +528,22 @@ void LVDC1B::Init(){
 
 	CommandSequence = 0;
 
-	if(!Initialized){ lvlog = fopen("lvlog1b.txt","w+"); } // Don't reopen the log if it's already open
+	if(!Initialized){ // Don't reopen the log if it's already open
+		lvlog = fopen("lvlog1b.txt","w+");
+		// Fully buffered, the log is written every timestep and must not go to disk line by line
+		setvbuf(lvlog, NULL, _IOFBF, 65536);
+	}
 	fprintf(lvlog,"init complete\r\n");
 	fflush(lvlog);
 	Initialized = true;
 }
 	
-void LVDC1B::SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table)
+LVDC1B::~LVDC1B()
+{
+	if (Initialized) { fclose(lvlog); }
+}
+
+void LVDC1B::SwitchSelectorProcessing(const std::vector<SwitchSelectorSet> &table)
 {
 	while (CommandSequence < (int)table.size() && LVDC_TB_ETime > table[CommandSequence].time)
 	{
@@ -544,7 +553,7 @@ void LVDC1B::SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table)
 	}
 }
 
-bool LVDC1B::SwitchSelectorSequenceComplete(std::vector<SwitchSelectorSet> table)
+bool LVDC1B::SwitchSelectorSequenceComplete(const std::vector<SwitchSelectorSet> &table)
 {
 	if (CommandSequence >= (int)table.size())
 		return true;
@@ -3141,7 +3150,11 @@ void LVDCSV::Init(){
 	CountPIPA = false;
 	SIICenterEngineCutoff = false;
 	FixedAttitudeBurn = false;
-	if(!Initialized){ lvlog = fopen("lvlog.txt","w+"); }
+	if(!Initialized){
+		lvlog = fopen("lvlog.txt","w+");
+		// Fully buffered, the log is written every timestep and must not go to disk line by line
+		setvbuf(lvlog, NULL, _IOFBF, 65536);
+	}
 	fprintf(lvlog,"init complete\r\n");
 	fflush(lvlog);
 	Initialized = true;
@@ -4542,7 +4555,12 @@ void LVDCSV::ReadFlightSequenceProgram(char *fspfile)
 	file.close();
 }
 
-void LVDCSV::SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table)
+LVDCSV::~LVDCSV()
+{
+	if (Initialized) { fclose(lvlog); }
+}
+
+void LVDCSV::SwitchSelectorProcessing(const std::vector<SwitchSelectorSet> &table)
 {
 	while (CommandSequence < (int)table.size() && LVDC_TB_ETime > table[CommandSequence].time)
 	{
@@ -4552,7 +4570,7 @@ void LVDCSV::SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table)
 	}
 }
 
-bool LVDCSV::SwitchSelectorSequenceComplete(std::vector<SwitchSelectorSet> table)
+bool LVDCSV::SwitchSelectorSequenceComplete(const std::vector<SwitchSelectorSet> &table)
 {
 	if (CommandSequence >= (int)table.size())
 		return true;
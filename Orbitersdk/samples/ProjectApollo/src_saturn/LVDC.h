@@ -74,14 +74,15 @@ protected:
 class LVDCSV: public LVDC {
 public:
 	LVDCSV(LVDA &lvd);											// Constructor
+	~LVDCSV();
 	void Init();
 	void TimeStep(double simdt);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(FILEHANDLE scn);
 	void ReadFlightSequenceProgram(char *fspfile);
 
-	void SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table);
-	bool SwitchSelectorSequenceComplete(std::vector<SwitchSelectorSet> table);
+	void SwitchSelectorProcessing(const std::vector<SwitchSelectorSet> &table);
+	bool SwitchSelectorSequenceComplete(const std::vector<SwitchSelectorSet> &table);
 
 	bool GetGuidanceReferenceFailure() { return GuidanceReferenceFailure; }
 
@@ -500,6 +501,7 @@ private:								// Saturn LV
 class LVDC1B: public LVDC {
 public:
 	LVDC1B(LVDA &lvd);										// Constructor
+	~LVDC1B();
 	void Init();
 	void TimeStep(double simdt);
 	void SaveState(FILEHANDLE scn);
@@ -507,8 +509,8 @@ public:
 
 	void ReadFlightSequenceProgram(char *fspfile);
 
-	void SwitchSelectorProcessing(std::vector<SwitchSelectorSet> table);
-	bool SwitchSelectorSequenceComplete(std::vector<SwitchSelectorSet> table);
+	void SwitchSelectorProcessing(const std::vector<SwitchSelectorSet> &table);
+	bool SwitchSelectorSequenceComplete(const std::vector<SwitchSelectorSet> &table);
 
 	bool GetGuidanceReferenceFailure() { return GuidanceReferenceFailure; }
 
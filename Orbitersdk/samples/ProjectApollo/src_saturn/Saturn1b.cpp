@@ -46,6 +46,7 @@
 #include "s1b.h"
 #include "LVDC.h"
 #include "iu.h"
+#include "NamedObjects.h"
 
 #include "tracer.h"
 
@@ -185,6 +186,7 @@ DLLCLBK VESSEL *ovcInit (OBJHANDLE hvessel, int flightmodel)
 	if (!refcount++) {
 		Saturn1bLoadMeshes();
 		SaturnInitMeshes();
+		NamedObjects::Invalidate();
 	}
 
 	BaseInit();
@@ -47,6 +47,7 @@
 #include "s1c.h"
 #include "LVDC.h"
 #include "iu.h"
+#include "NamedObjects.h"
 #include "tracer.h"
 
 //
@@ -328,6 +329,7 @@ DLLCLBK VESSEL *ovcInit (OBJHANDLE hvessel, int flightmodel)
 		TRACE("refcount == 0");
 		LoadSat5Meshes();
 		SaturnInitMeshes();
+		NamedObjects::Invalidate();
 	}
 
 	TRACE("Meshes loaded");
@@ -34,6 +34,7 @@
 
 #include "saturn.h"
 #include "papi.h"
+#include "NamedObjects.h"
 #include "IUUmbilical.h"
 
 #include "iu.h"
@@ -209,10 +210,10 @@ VECTOR3 IU::GetTheodoliteAlignment(double azimuth)
 	X_NB = _V(R.m12, R.m22, R.m32);
 	Z_NB = _V(R.m13, R.m23, R.m33);
 	Y_NB = -_V(R.m11, R.m21, R.m31);
-	lvCommandConnector.GetRelativePos(oapiGetObjectByName("Earth"), pos);
+	lvCommandConnector.GetRelativePos(NamedObjects::Earth(), pos);
 	X_SM = unit(_V(pos.x, pos.z, pos.y));
 	//Get polar axis
-	oapiGetRotationMatrix(oapiGetObjectByName("Earth"), &Rot);
+	oapiGetRotationMatrix(NamedObjects::Earth(), &Rot);
 	U_Z =_V(Rot.m12, Rot.m32, Rot.m22);
 
 	E = unit(crossp(-X_SM, U_Z));
@@ -528,6 +529,12 @@ bool IUToCSMCommandConnector::GetCMCSIVBTakeover()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_CMC_SIVB_TAKEOVER, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_CMC_SIVB_TAKEOVER;
@@ -544,6 +551,12 @@ bool IUToCSMCommandConnector::GetCMCSIVBIgnitionSequenceStart()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_CMC_SIVB_IGNITION, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_CMC_SIVB_IGNITION;
@@ -560,6 +573,12 @@ bool IUToCSMCommandConnector::GetCMCSIVBCutoff()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_CMC_SIVB_CUTOFF, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_CMC_SIVB_CUTOFF;
@@ -593,6 +612,12 @@ bool IUToCSMCommandConnector::GetTLIInhibitSignal()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_TLI_INHIBIT, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_TLI_INHIBIT;
@@ -609,6 +634,12 @@ bool IUToCSMCommandConnector::GetIUUPTLMAccept()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_IU_UPTLM_ACCEPT, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_IU_UPTLM_ACCEPT;
@@ -624,6 +655,12 @@ bool IUToCSMCommandConnector::GetIUUPTLMAccept()
 bool IUToCSMCommandConnector::IsEDSUnsafeA()
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_EDS_UNSAFE_A, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_IS_EDS_UNSAFE_A;
@@ -639,6 +676,12 @@ bool IUToCSMCommandConnector::IsEDSUnsafeA()
 bool IUToCSMCommandConnector::IsEDSUnsafeB()
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_EDS_UNSAFE_B, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_IS_EDS_UNSAFE_B;
@@ -655,6 +698,12 @@ bool IUToCSMCommandConnector::GetSIISIVbDirectStagingSignal()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_SIISIVB_DIRECT_STAGING, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_SIISIVB_DIRECT_STAGING;
@@ -671,6 +720,12 @@ int IUToCSMCommandConnector::LVRateAutoSwitchState()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_LV_RATE_AUTO_SWITCH_STATE, v))
+	{
+		return v.iValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_LV_RATE_AUTO_SWITCH_STATE;
@@ -687,6 +742,12 @@ int IUToCSMCommandConnector::TwoEngineOutAutoSwitchState()
 
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(CSMIU_SLOT_TWO_ENGINE_OUT_AUTO_SWITCH_STATE, v))
+	{
+		return v.iValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_TWO_ENGINE_OUT_AUTO_SWITCH_STATE;
@@ -702,6 +763,12 @@ int IUToCSMCommandConnector::TwoEngineOutAutoSwitchState()
 bool IUToCSMCommandConnector::GetBECOCommand(bool IsSysA)
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (ReadRemoteSlot(IsSysA ? CSMIU_SLOT_BECO_COMMAND_A : CSMIU_SLOT_BECO_COMMAND_B, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_BECO_COMMAND;
@@ -718,6 +785,12 @@ bool IUToCSMCommandConnector::GetBECOCommand(bool IsSysA)
 bool IUToCSMCommandConnector::IsEDSBusPowered(int eds)
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (eds >= 1 && eds <= 3 && ReadRemoteSlot(CSMIU_SLOT_EDS_BUS_1_POWERED + eds - 1, v))
+	{
+		return v.bValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_IS_EDS_BUS_POWERED;
@@ -734,6 +807,12 @@ bool IUToCSMCommandConnector::IsEDSBusPowered(int eds)
 int IUToCSMCommandConnector::GetAGCAttitudeError(int axis)
 {
 	ConnectorMessage cm;
+	ConnectorMessageValue v;
+
+	if (axis >= 0 && axis <= 2 && ReadRemoteSlot(CSMIU_SLOT_AGC_ATTITUDE_ERROR_X + axis, v))
+	{
+		return v.iValue;
+	}
 
 	cm.destination = CSM_IU_COMMAND;
 	cm.messageType = IUCSM_GET_AGC_ATTITUDE_ERROR;
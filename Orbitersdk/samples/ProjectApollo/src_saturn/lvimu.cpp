@@ -28,6 +28,7 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "Orbitersdk.h"
 #include "papi.h"
+#include "NamedObjects.h"
 #include "iu.h"
 #include "LVIMU.h"
 
@@ -433,7 +434,7 @@ void LVIMU::SetOrbiterAttitudeReference()
 VECTOR3 LVIMU::GetGravityVector()
 {
 	OBJHANDLE gravref = OurVessel->GetLVCommandConnector()->GetGravityRef();
-	OBJHANDLE hSun = oapiGetObjectByName("Sun");
+	OBJHANDLE hSun = NamedObjects::Sun();
 	VECTOR3 R, U_R;
 	OurVessel->GetLVCommandConnector()->GetRelativePos(gravref, R);
 	U_R = unit(R);
@@ -486,9 +487,9 @@ VECTOR3 LVIMU::GetGravityVector()
 	a_dP *= mu / pow(r, 2.0);
 	a_dP -= U_R_S * mu_S / pow(r_S, 2.0);
 
-	if (gravref == oapiGetObjectByName("Moon"))
+	if (gravref == NamedObjects::Moon())
 	{
-		OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+		OBJHANDLE hEarth = NamedObjects::Earth();
 
 		VECTOR3 R_Ea, U_R_E;
 		OurVessel->GetLVCommandConnector()->GetRelativePos(hEarth, R_Ea);
@@ -47,6 +47,7 @@
 #include "astp.h"
 #include "lem.h"
 #include "LVDC.h"
+#include "NamedObjects.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -1936,6 +1937,7 @@ DLLCLBK VESSEL *ovcInit (OBJHANDLE hvessel, int flightmodel)
 	if (!refcount++)
 	{
 		SIVbLoadMeshes();
+		NamedObjects::Invalidate();
 	}
 
 	v = new SIVB (hvessel, flightmodel);
@@ -0,0 +1,451 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Precompiled checklist image
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include "checklistController.h"
+#include "ChecklistImage.h"
+
+#pragma warning ( push )
+#pragma warning ( disable:4018 )
+#pragma warning ( disable:4996 )
+
+//
+// File layout: header, groups, items, DSKY/DEDA keys, string table.
+// Strings are offsets into the string table, which starts with an empty string.
+//
+
+struct ChecklistImageHeader
+{
+	char Magic[8];
+	int Version;
+	int GroupSize;
+	int ItemSize;
+	int KeySize;
+	// Size and time stamp of the workbook the image was compiled from
+	DWORD SourceSizeLow;
+	DWORD SourceSizeHigh;
+	FILETIME SourceTime;
+	unsigned NumGroups;
+	unsigned NumItems;
+	unsigned NumKeys;
+	unsigned StringsSize;
+};
+
+struct ChecklistImageGroup
+{
+	double time;
+	double deadline;
+	int relativeEvent;
+	unsigned name;
+	unsigned heading;
+	unsigned soundFile;
+	unsigned char manualSelect;
+	unsigned char autoSelect;
+	unsigned char essential;
+	unsigned char autoSlow;
+	unsigned firstItem;
+	unsigned numItems;
+};
+
+struct ChecklistImageItem
+{
+	double time;
+	int relativeEvent;
+	int failGroup;
+	int callGroup;
+	unsigned text;
+	unsigned panel;
+	unsigned heading1;
+	unsigned heading2;
+	unsigned info;
+	unsigned varlist;
+	unsigned item;
+	int position;
+	unsigned char automatic;
+	unsigned char guard;
+	unsigned char hold;
+	unsigned char lineFeed;
+	int type;
+	int dskyNo;
+	unsigned firstKey;
+	unsigned numKeys;
+};
+
+// DSKY or DEDA key with the panel switches it resolves to
+struct ChecklistImageKey
+{
+	unsigned key;
+	unsigned item;
+	unsigned item2;
+};
+
+static const char ChecklistImageMagic[8] = { 'N', 'A', 'S', 'S', 'P', 'C', 'H', 'K' };
+
+//
+// Collects the strings of the image, every distinct string is stored once.
+//
+
+class ChecklistImageStrings
+{
+public:
+	ChecklistImageStrings() { data.push_back(0); };
+
+	unsigned Add(const char *s)
+	{
+		if (s[0] == 0)
+			return 0;
+		std::map<std::string, unsigned>::iterator it = index.find(s);
+		if (it != index.end())
+			return it->second;
+		unsigned offset = data.size();
+		data.insert(data.end(), s, s + strlen(s) + 1);
+		index[s] = offset;
+		return offset;
+	}
+
+	std::vector<char> data;
+
+protected:
+	std::map<std::string, unsigned> index;
+};
+
+static void ChecklistImageCopy(char *dst, const char *src, size_t n)
+{
+	strncpy(dst, src, n - 1);
+	dst[n - 1] = 0;
+}
+
+static bool ChecklistImageSource(const char *workbook, WIN32_FILE_ATTRIBUTE_DATA &data)
+{
+	return GetFileAttributesEx(workbook, GetFileExInfoStandard, &data) != 0;
+}
+
+ChecklistImage::ChecklistImage()
+{
+	hFile = INVALID_HANDLE_VALUE;
+	hMapping = NULL;
+	view = NULL;
+	size = 0;
+}
+
+ChecklistImage::~ChecklistImage()
+{
+	Close();
+}
+
+std::string ChecklistImage::FileName(const char *workbook)
+{
+	std::string name(workbook);
+	size_t pos = name.find_last_of("\\/");
+	if (pos != std::string::npos)
+		name = name.substr(pos + 1);
+	pos = name.find_last_of('.');
+	if (pos != std::string::npos)
+		name = name.substr(0, pos);
+	return ".\\Config\\ProjectApollo\\Checklist\\" + name + ".chk";
+}
+
+bool ChecklistImage::Open(const char *workbook)
+{
+	WIN32_FILE_ATTRIBUTE_DATA source;
+
+	Close();
+	if (!ChecklistImageSource(workbook, source))
+		return false;
+
+	hFile = CreateFile(FileName(workbook).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	size = GetFileSize(hFile, NULL);
+	if (size == INVALID_FILE_SIZE || size < sizeof(ChecklistImageHeader))
+	{
+		Close();
+		return false;
+	}
+	hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (hMapping == NULL)
+	{
+		Close();
+		return false;
+	}
+	view = (const char *)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == NULL)
+	{
+		Close();
+		return false;
+	}
+
+	//Reject images of another version or of an older copy of the workbook
+	const ChecklistImageHeader *h = (const ChecklistImageHeader *)view;
+	double expected = (double)sizeof(ChecklistImageHeader) + (double)h->NumGroups * sizeof(ChecklistImageGroup) +
+		(double)h->NumItems * sizeof(ChecklistImageItem) + (double)h->NumKeys * sizeof(ChecklistImageKey) + (double)h->StringsSize;
+
+	if (memcmp(h->Magic, ChecklistImageMagic, 8) || h->Version != CHECKLIST_IMAGE_VERSION ||
+		h->GroupSize != sizeof(ChecklistImageGroup) || h->ItemSize != sizeof(ChecklistImageItem) || h->KeySize != sizeof(ChecklistImageKey) ||
+		h->SourceSizeLow != source.nFileSizeLow || h->SourceSizeHigh != source.nFileSizeHigh ||
+		CompareFileTime(&h->SourceTime, &source.ftLastWriteTime) != 0 ||
+		expected != (double)size || h->StringsSize == 0 || view[size - 1] != 0)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void ChecklistImage::Close()
+{
+	if (view)
+		UnmapViewOfFile(view);
+	if (hMapping)
+		CloseHandle(hMapping);
+	if (hFile != INVALID_HANDLE_VALUE)
+		CloseHandle(hFile);
+	hFile = INVALID_HANDLE_VALUE;
+	hMapping = NULL;
+	view = NULL;
+	size = 0;
+}
+
+const char *ChecklistImage::String(unsigned offset)
+{
+	const ChecklistImageHeader *h = (const ChecklistImageHeader *)view;
+	const char *strings = view + size - h->StringsSize;
+
+	if (offset >= h->StringsSize)
+		return "";
+	return strings + offset;
+}
+
+bool ChecklistImage::GetGroups(std::vector<ChecklistGroup> &groups)
+{
+	groups.clear();
+	if (!view)
+		return false;
+
+	const ChecklistImageHeader *h = (const ChecklistImageHeader *)view;
+	const ChecklistImageGroup *g = (const ChecklistImageGroup *)(view + sizeof(ChecklistImageHeader));
+	ChecklistGroup temp;
+
+	groups.reserve(h->NumGroups);
+	for (unsigned i = 0; i < h->NumGroups; i++)
+	{
+		temp = ChecklistGroup();
+		temp.group = i;
+		temp.time = g[i].time;
+		temp.deadline = g[i].deadline;
+		temp.relativeEvent = (RelativeEvent)g[i].relativeEvent;
+		ChecklistImageCopy(temp.name, String(g[i].name), sizeof(temp.name));
+		ChecklistImageCopy(temp.heading, String(g[i].heading), sizeof(temp.heading));
+		ChecklistImageCopy(temp.soundFile, String(g[i].soundFile), sizeof(temp.soundFile));
+		temp.manualSelect = g[i].manualSelect != 0;
+		temp.autoSelect = g[i].autoSelect != 0;
+		temp.essential = g[i].essential != 0;
+		temp.autoSlow = g[i].autoSlow != 0;
+		groups.push_back(temp);
+	}
+	return true;
+}
+
+bool ChecklistImage::GetItems(int group, std::vector<ChecklistItem> &items)
+{
+	if (!view)
+		return false;
+
+	const ChecklistImageHeader *h = (const ChecklistImageHeader *)view;
+	if (group < 0 || (unsigned)group >= h->NumGroups)
+		return false;
+
+	const ChecklistImageGroup *g = (const ChecklistImageGroup *)(view + sizeof(ChecklistImageHeader)) + group;
+	const ChecklistImageItem *it = (const ChecklistImageItem *)(view + sizeof(ChecklistImageHeader) + h->NumGroups * sizeof(ChecklistImageGroup));
+	const ChecklistImageKey *k = (const ChecklistImageKey *)(it + h->NumItems);
+
+	if (g->firstItem > h->NumItems || g->numItems > h->NumItems - g->firstItem)
+		return false;
+
+	items.reserve(items.size() + g->numItems);
+	for (unsigned i = g->firstItem; i < g->firstItem + g->numItems; i++)
+	{
+		ChecklistItem temp;
+
+		temp.group = group;
+		temp.index = items.size();
+		temp.time = it[i].time;
+		temp.relativeEvent = (RelativeEvent)it[i].relativeEvent;
+		temp.failGroup = it[i].failGroup;
+		temp.callGroup = it[i].callGroup;
+		ChecklistImageCopy(temp.text, String(it[i].text), sizeof(temp.text));
+		ChecklistImageCopy(temp.panel, String(it[i].panel), sizeof(temp.panel));
+		ChecklistImageCopy(temp.heading1, String(it[i].heading1), sizeof(temp.heading1));
+		ChecklistImageCopy(temp.heading2, String(it[i].heading2), sizeof(temp.heading2));
+		ChecklistImageCopy(temp.info, String(it[i].info), sizeof(temp.info));
+		ChecklistImageCopy(temp.varlist, String(it[i].varlist), sizeof(temp.varlist));
+		ChecklistImageCopy(temp.item, String(it[i].item), sizeof(temp.item));
+		temp.position = it[i].position;
+		temp.automatic = it[i].automatic != 0;
+		temp.guard = it[i].guard != 0;
+		temp.hold = it[i].hold != 0;
+		temp.lineFeed = it[i].lineFeed != 0;
+		temp.type = (ChecklistItemType)it[i].type;
+		temp.dskyNo = it[i].dskyNo;
+
+		if (it[i].firstKey > h->NumKeys || it[i].numKeys > h->NumKeys - it[i].firstKey)
+			return false;
+		for (unsigned j = it[i].firstKey; j < it[i].firstKey + it[i].numKeys; j++)
+		{
+			if (temp.type == CHECKLIST_ITEM_DSKY)
+			{
+				DSKYChecklistItem key;
+				ChecklistImageCopy(key.key, String(k[j].key), sizeof(key.key));
+				ChecklistImageCopy(key.item, String(k[j].item), sizeof(key.item));
+				ChecklistImageCopy(key.item2, String(k[j].item2), sizeof(key.item2));
+				temp.dskyItemsSet.push_back(key);
+			}
+			else if (temp.type == CHECKLIST_ITEM_DEDA)
+			{
+				DEDAChecklistItem key;
+				ChecklistImageCopy(key.key, String(k[j].key), sizeof(key.key));
+				ChecklistImageCopy(key.item, String(k[j].item), sizeof(key.item));
+				temp.dedaItemsSet.push_back(key);
+			}
+		}
+		items.push_back(temp);
+	}
+	return true;
+}
+
+bool ChecklistImage::Compile(const char *workbook, const std::vector<ChecklistGroup> &groups, const std::vector<std::vector<ChecklistItem> > &items)
+{
+	WIN32_FILE_ATTRIBUTE_DATA source;
+	ChecklistImageHeader h;
+	std::vector<ChecklistImageGroup> g;
+	std::vector<ChecklistImageItem> it;
+	std::vector<ChecklistImageKey> k;
+	ChecklistImageStrings strings;
+
+	if (!ChecklistImageSource(workbook, source) || items.size() != groups.size())
+		return false;
+
+	for (unsigned i = 0; i < groups.size(); i++)
+	{
+		ChecklistImageGroup group;
+		memset(&group, 0, sizeof(group));
+		group.time = groups[i].time;
+		group.deadline = groups[i].deadline;
+		group.relativeEvent = groups[i].relativeEvent;
+		group.name = strings.Add(groups[i].name);
+		group.heading = strings.Add(groups[i].heading);
+		group.soundFile = strings.Add(groups[i].soundFile);
+		group.manualSelect = groups[i].manualSelect;
+		group.autoSelect = groups[i].autoSelect;
+		group.essential = groups[i].essential;
+		group.autoSlow = groups[i].autoSlow;
+		group.firstItem = it.size();
+		group.numItems = items[i].size();
+		g.push_back(group);
+
+		for (unsigned j = 0; j < items[i].size(); j++)
+		{
+			const ChecklistItem &src = items[i][j];
+			ChecklistImageItem item;
+			memset(&item, 0, sizeof(item));
+			item.time = src.time;
+			item.relativeEvent = src.relativeEvent;
+			item.failGroup = src.failGroup;
+			item.callGroup = src.callGroup;
+			item.text = strings.Add(src.text);
+			item.panel = strings.Add(src.panel);
+			item.heading1 = strings.Add(src.heading1);
+			item.heading2 = strings.Add(src.heading2);
+			item.info = strings.Add(src.info);
+			item.varlist = strings.Add(src.varlist);
+			item.item = strings.Add(src.item);
+			item.position = src.position;
+			item.automatic = src.automatic;
+			item.guard = src.guard;
+			item.hold = src.hold;
+			item.lineFeed = src.lineFeed;
+			item.type = src.type;
+			item.dskyNo = src.dskyNo;
+			item.firstKey = k.size();
+
+			ChecklistImageKey key;
+			for (unsigned l = 0; l < src.dskyItemsSet.size(); l++)
+			{
+				key.key = strings.Add(src.dskyItemsSet[l].key);
+				key.item = strings.Add(src.dskyItemsSet[l].item);
+				key.item2 = strings.Add(src.dskyItemsSet[l].item2);
+				k.push_back(key);
+			}
+			for (unsigned l = 0; l < src.dedaItemsSet.size(); l++)
+			{
+				key.key = strings.Add(src.dedaItemsSet[l].key);
+				key.item = strings.Add(src.dedaItemsSet[l].item);
+				key.item2 = 0;
+				k.push_back(key);
+			}
+			item.numKeys = k.size() - item.firstKey;
+			it.push_back(item);
+		}
+	}
+
+	memset(&h, 0, sizeof(h));
+	memcpy(h.Magic, ChecklistImageMagic, 8);
+	h.Version = CHECKLIST_IMAGE_VERSION;
+	h.GroupSize = sizeof(ChecklistImageGroup);
+	h.ItemSize = sizeof(ChecklistImageItem);
+	h.KeySize = sizeof(ChecklistImageKey);
+	h.SourceSizeLow = source.nFileSizeLow;
+	h.SourceSizeHigh = source.nFileSizeHigh;
+	h.SourceTime = source.ftLastWriteTime;
+	h.NumGroups = g.size();
+	h.NumItems = it.size();
+	h.NumKeys = k.size();
+	h.StringsSize = strings.data.size();
+
+	CreateDirectory(".\\Config\\ProjectApollo\\Checklist", NULL);
+
+	FILE *f = fopen(FileName(workbook).c_str(), "wb");
+	if (!f)
+		return false;
+
+	bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+	if (ok && g.size())
+		ok = fwrite(&g[0], sizeof(ChecklistImageGroup), g.size(), f) == g.size();
+	if (ok && it.size())
+		ok = fwrite(&it[0], sizeof(ChecklistImageItem), it.size(), f) == it.size();
+	if (ok && k.size())
+		ok = fwrite(&k[0], sizeof(ChecklistImageKey), k.size(), f) == k.size();
+	if (ok)
+		ok = fwrite(&strings.data[0], 1, strings.data.size(), f) == strings.data.size();
+	fclose(f);
+
+	//Never leave a partial image behind
+	if (!ok)
+		remove(FileName(workbook).c_str());
+	return ok;
+}
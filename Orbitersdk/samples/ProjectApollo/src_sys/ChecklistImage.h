@@ -0,0 +1,75 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Precompiled checklist image (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <windows.h>
+#include <vector>
+#include <string>
+
+struct ChecklistGroup;
+struct ChecklistItem;
+
+/// Increment when the layout of the image changes, older images are then recompiled.
+#define CHECKLIST_IMAGE_VERSION 1
+
+///
+/// Binary image of a checklist workbook. Groups and items are stored already parsed, with
+/// events, called groups and DSKY/DEDA keys resolved and all texts in a shared string table.
+/// The image is compiled from the workbook the first time it is loaded and is read back from
+/// a memory mapped view of the file as long as the workbook doesn't change.
+///
+class ChecklistImage
+{
+public:
+	ChecklistImage();
+	~ChecklistImage();
+
+	/// Maps the image of the given workbook. Returns false if there is no image or it is out of date.
+	bool Open(const char *workbook);
+	void Close();
+	bool IsOpen() { return view != NULL; };
+
+	/// Groups of the workbook in index order.
+	bool GetGroups(std::vector<ChecklistGroup> &groups);
+	/// Items of a group, the same as reading the group's worksheet.
+	bool GetItems(int group, std::vector<ChecklistItem> &items);
+
+	/// Writes the image of a workbook from its parsed groups and items, items[i] belongs to groups[i].
+	static bool Compile(const char *workbook, const std::vector<ChecklistGroup> &groups, const std::vector<std::vector<ChecklistItem> > &items);
+	/// Image file name of a workbook.
+	static std::string FileName(const char *workbook);
+
+protected:
+	const char *String(unsigned offset);
+
+	HANDLE hFile;
+	HANDLE hMapping;
+	const char *view;
+	unsigned size;
+
+private:
+	// The mapping is owned, not copyable
+	ChecklistImage(const ChecklistImage &);
+	void operator=(const ChecklistImage &);
+};
@@ -57,118 +57,33 @@ FDAI::FDAI() {
 	noAC = false;
 }
 
-void FDAI::InitGL() {
-
-	GLuint      PixelFormat;
-	BITMAPINFOHEADER BIH;
-	int iSize = sizeof(BITMAPINFOHEADER);
-	BIH.biSize = iSize;
-	BIH.biWidth = 180;				//size of the sphere is 180x180
-	BIH.biHeight = 180;
-	BIH.biPlanes = 1;
-	BIH.biBitCount = 16;//default is 16.
-	BIH.biCompression = BI_RGB;
-	BIH.biSizeImage = 0;
-	void* m_pBits;
-	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap for OpenGL to draw onto
-	static  PIXELFORMATDESCRIPTOR pfd2;
-	DescribePixelFormat(hDC2, 1, sizeof(PIXELFORMATDESCRIPTOR), &pfd2);//just get a random pixel format.. 
-	BIH.biBitCount = pfd2.cColorBits;//to get the current bit depth.. !?
-	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &m_pBits, NULL, 0);
-	hBMP_old = (HBITMAP)SelectObject(hDC2, hBMP);
-	static  PIXELFORMATDESCRIPTOR pfd = {                             // pfd Tells Windows How We Want Things To Be
-		sizeof(PIXELFORMATDESCRIPTOR),                              // Size Of This Pixel Format Descriptor
-		1,                                                          // Version Number
-		PFD_DRAW_TO_BITMAP |                                        // Format Must Support Bitmap Rendering
-		PFD_SUPPORT_OPENGL |
-		PFD_SUPPORT_GDI,											// Format Must Support OpenGL,                                           
-		0,//        PFD_TYPE_RGBA,                                              // Request An RGBA Format
-		16,															// Select Our Color Depth
-		0, 0, 0, 0, 0, 0,                                           // Color Bits Ignored
-		0,//1,                                                          // No Alpha Buffer
-		0,                                                          // Shift Bit Ignored
-		0,                                                          // No Accumulation Buffer
-		0, 0, 0, 0,                                                 // Accumulation Bits Ignored
-		0,//16,                                                         // 16Bit Z-Buffer (Depth Buffer)  
-		0,                                                          // No Stencil Buffer
-		0,                                                          // No Auxiliary Buffer
-		0,//PFD_MAIN_PLANE,                                             // Main Drawing Layer
-		0,                                                          // Reserved
-		0, 0, 0                                                     // Layer Masks Ignored
-	};
-	pfd.cColorBits = pfd2.cColorBits;//same color depth needed.
-	DWORD code;
-	code = GetLastError();
-	PixelFormat = ChoosePixelFormat(hDC2, &pfd);// now pretend we want a new format
-	int ret;
-	ret = SetPixelFormat(hDC2, PixelFormat, &pfd);
-	code = GetLastError();
-	hRC = wglCreateContext(hDC2);
-	ret = wglMakeCurrent(hDC2, hRC);				//all standard OpenGL init so far
+void FDAI::InitBall() {
+
+	//We render the 180x180 sphere view, of which the 150x150 part at 10,10 is shown on the panel
+	ball.Init(180, 10, 10, 150, 150);
+	ballPixels.resize(150 * 150);
 
 	//We load the texture
-	int texture_index;
+	bool loaded;
 	if (LM_FDAI)
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
+		loaded = LoadBallTexture("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
 	}
 	else
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball.dds");
+		loaded = LoadBallTexture("Textures\\ProjectApollo\\FDAI_Ball.dds");
+	}
+	if (!loaded)
+	{
+		//Plain lit ball, as the OpenGL version drew it without a texture
+		static const unsigned char white[3] = { 255, 255, 255 };
+		ball.SetTexture(white, 1, 1);
 	}
-	if (texture_index > 0) glEnable(GL_TEXTURE_2D);
-
-	glShadeModel(GL_SMOOTH);                        // Enable Smooth Shading
-	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);           // Panel Background color
-	glClearDepth(1.0f);                             // Depth Buffer Setup
-	glEnable(GL_DEPTH_TEST);                        // Enables Depth Testing
-	glDepthFunc(GL_LESS);                           // The Type Of Depth Testing To Do
-	glViewport(0, 0, 180, 180);                     // Reset The Current Viewport
-	glMatrixMode(GL_PROJECTION);                    // Select The Projection Matrix
-	glLoadIdentity();                               // Reset The Projection Matrix
-	gluPerspective(45.0f, 1.0, 1.0f, 1000.0f);
-	glMatrixMode(GL_MODELVIEW);                     // Select The Modelview Matrix          
-	glLoadIdentity();                               // Reset The Projection Matrix
-
-	//some ambiental setup
-	GLfloat light_position[] = { -10.0,10.0,10.0,0.0 };
-	GLfloat light_diffuse[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat light_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat mat_specular[] = { (float) 0.5, (float) 0.5, (float) 0.5, 1.0 };
-	GLfloat mat_shin[] = { 5.0 };
-	glMaterialfv(GL_FRONT, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHTING);
-	glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
-	glLightfv(GL_LIGHT0, GL_POSITION, light_position);
-	glLightfv(GL_LIGHT0, GL_AMBIENT, light_ambient);
-	glLightfv(GL_LIGHT0, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHT0);
-
-	//defining our geometry and composing a display list;
-	list_name = glGenLists(1);
-	glNewList(list_name, GL_COMPILE);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);             // Clear The Screen And The Depth Buffer        
-	glColor3f(1.0, 1.0, 1.0);
-	quadObj = gluNewQuadric();
-	gluQuadricTexture(quadObj, GL_TRUE);
-	gluSphere(quadObj, 12, 24, 24);
-	glEndList();
-
-	init = 1;		//that's it. If we made it so far, we can use OpenGL
+
+	init = 1;
 }
 
 FDAI::~FDAI() {
-
-	if (init) {
-		gluDeleteQuadric(quadObj);
-		wglMakeCurrent(NULL, NULL);	//standard OpenGL release
-		BOOL ret = wglDeleteContext(hRC);
-		hRC = NULL;
-		SelectObject(hDC2, hBMP_old);//remember to delete DC and bitmap memory we created
-		DeleteObject(hBMP);
-		DeleteDC(hDC2);
-		hDC2 = 0;
-	}
 }
 
 void FDAI::RegisterMe(int index, int x, int y) {
@@ -268,36 +183,34 @@ void FDAI::MoveBall() {
 			now.x += delta;
 	}
 
-	glLoadIdentity();
-	gluLookAt(0.0, -35.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
-
-	glRotatef(90.0, 0.0, 1.0, 0.0);
-
-	glRotated(now.y / PI * 180.0, 0.0, 1.0, 0.0);	//attitude.x
-	glRotated(now.x / PI * 180.0, 1.0, 0.0, 0.0);	//attitude.z
-	glRotated(now.z / PI * 180.0, 0.0, 0.0, 1.0);	//attitude.y
+	ball.Render(now.y, now.x, now.z, &ballPixels[0], 150);
 }
 
 void FDAI::PaintMe(VECTOR3 attitude, int no_att, VECTOR3 rates, VECTOR3 errors, SURFHANDLE surf, SURFHANDLE hFDAI,
 	SURFHANDLE hFDAIRoll, SURFHANDLE hFDAIOff, SURFHANDLE hFDAINeedles, HBITMAP hBmpRoll, int smooth) {
 
-	if (!init) InitGL();
+	if (!init) InitBall();
 
 	SetAttitude(attitude);
 
-	// Don't do the OpenGL calculations every timestep
+	// Don't render the ball every timestep
 	if (smooth || lastPaintTime == -1 || ((length(now - target) > 0.005 || oapiGetSysTime() > lastPaintTime + 2.0) && oapiGetSysTime() > lastPaintTime + 0.1)) {
-		int ret = wglMakeCurrent(hDC2, hRC);
 		MoveBall();
-		glCallList(list_name);	//render
-		glFlush();
-		glFinish();
 
 		lastPaintTime = oapiGetSysTime();
 	}
 
+	BITMAPINFO bi;
+	memset(&bi, 0, sizeof(bi));
+	bi.bmiHeader.biSize = sizeof(bi.bmiHeader);
+	bi.bmiHeader.biWidth = 150;
+	bi.bmiHeader.biHeight = -150;	//top-down
+	bi.bmiHeader.biPlanes = 1;
+	bi.bmiHeader.biBitCount = 32;
+	bi.bmiHeader.biCompression = BI_RGB;
+
 	HDC hDC = oapiGetDC(surf);
-	BitBlt(hDC, 43, 43, 150, 150, hDC2, 10, 10, SRCCOPY);//then we bitblt onto the panel.
+	SetDIBitsToDevice(hDC, 43, 43, 150, 150, 0, 0, 0, 150, &ballPixels[0], &bi, DIB_RGB_COLORS);//then we copy the ball onto the panel.
 
 	// roll indicator
 	HDC hDCRotate;
@@ -461,50 +374,43 @@ void FDAI::SystemTimestep(double simdt) {
 	}
 }
 
-int FDAI::LoadOGLBitmap(char *filename) {
+bool FDAI::LoadBallTexture(char *filename) {
 
-	unsigned char *l_texture;
-	int l_index, l_index2 = 0;
 	FILE *file;
 	BITMAPFILEHEADER fileheader;
 	BITMAPINFOHEADER infoheader;
-	RGBTRIPLE rgb;
-	int num_texture = 1; //we only use one OGL texture ,so...
-
-
-	if ((file = fopen(filename, "rb")) == NULL) return (-1);
-	fread(&fileheader, sizeof(fileheader), 1, file);
-	fseek(file, sizeof(fileheader), SEEK_SET);
-	fread(&infoheader, sizeof(infoheader), 1, file);
-
-	l_texture = (byte *)malloc(infoheader.biWidth * infoheader.biHeight * 4);
-	memset(l_texture, 0, infoheader.biWidth * infoheader.biHeight * 4);
+	std::vector<unsigned char> texture;
+	int row;
+
+	//The ball textures are uncompressed 24 bit bitmaps
+	if ((file = fopen(filename, "rb")) == NULL) return false;
+	if (fread(&fileheader, sizeof(fileheader), 1, file) != 1 || fread(&infoheader, sizeof(infoheader), 1, file) != 1 ||
+		infoheader.biBitCount != 24 || infoheader.biWidth <= 0 || infoheader.biHeight <= 0) {
+		fclose(file);
+		return false;
+	}
 
-	for (l_index = 0; l_index < infoheader.biWidth*infoheader.biHeight; l_index++)
+	//Rows are padded to 4 bytes in the file
+	row = infoheader.biWidth * 3;
+	texture.resize(row * infoheader.biHeight);
+	for (int i = 0; i < infoheader.biHeight; i++)
 	{
-		fread(&rgb, sizeof(rgb), 1, file);
-
-		l_texture[l_index2 + 0] = rgb.rgbtRed; // Red component
-		l_texture[l_index2 + 1] = rgb.rgbtGreen; // Green component
-		l_texture[l_index2 + 2] = rgb.rgbtBlue; // Blue component
-		l_texture[l_index2 + 3] = 255; // Alpha value
-		l_index2 += 4; // Go to the next position
+		if (fseek(file, fileheader.bfOffBits + i * ((row + 3) & ~3), SEEK_SET) != 0 || fread(&texture[i * row], row, 1, file) != 1)
+		{
+			//Short file, read the pixels unpadded right after the headers like the old loader did
+			if (fseek(file, sizeof(fileheader) + sizeof(infoheader), SEEK_SET) != 0 || fread(&texture[0], texture.size(), 1, file) != 1)
+			{
+				fclose(file);
+				return false;
+			}
+			break;
+		}
 	}
 
 	fclose(file); // Closes the file stream
 
-	glBindTexture(GL_TEXTURE_2D, num_texture);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	//glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-	glTexImage2D(GL_TEXTURE_2D, 0, 4, infoheader.biWidth, infoheader.biHeight,
-		0, GL_RGBA, GL_UNSIGNED_BYTE, l_texture);
-	free(l_texture);
-
-	return (num_texture);
+	ball.SetTexture(&texture[0], infoheader.biWidth, infoheader.biHeight);
+	return true;
 }
 
 void DrawTransparentBitmap(HDC hdc, HBITMAP hBitmap, short xStart,
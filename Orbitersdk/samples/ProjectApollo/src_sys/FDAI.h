@@ -25,8 +25,7 @@
 /// \bug Avoids bug in VC++
 #pragma once
 
-#include < GL\gl.h >                                
-#include < GL\glu.h >
+#include "FDAIBall.h"
 
 class FDAI {
 
@@ -53,25 +52,21 @@ protected:
 	int ScrY;			//coords on screen
 	int idx;			//index on the panel list 
 	int init;
-	int list_name; //we store the rendering into a display list
 	VECTOR3 now, target, lastRates, lastErrors;
 	double lastPaintTime;
 	bool newRegistered;
 
-	//some stuff for OpenGL
-	HDC hDC2;
-	HGLRC hRC;
-	HBITMAP hBMP;
-	HBITMAP hBMP_old;
-	GLUquadricObj *quadObj;
+	//the ball is rendered in software into this pixel buffer
+	FDAIBall ball;
+	std::vector<uint32_t> ballPixels;
 
 	e_object *DCSource, *ACSource;
 	bool noAC;
 
-	void InitGL();
+	void InitBall();
 	void MoveBall();
 	void SetAttitude(VECTOR3 attitude);
-	int LoadOGLBitmap(char *filename);
+	bool LoadBallTexture(char *filename);
 };
 
 //
@@ -0,0 +1,220 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Software renderer for the FDAI attitude ball.
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "FDAIBall.h"
+
+// View setup of the old OpenGL renderer
+static const double FDAIBALL_FOV = 45.0;		// Vertical field of view, degrees
+static const double FDAIBALL_DISTANCE = 35.0;	// Distance of the eye from the ball center
+static const double FDAIBALL_RADIUS = 12.0;		// Ball radius
+
+static const float FDAIBALL_PI = 3.14159265f;
+
+//
+// atan2 approximation (error about 1e-5 rad) without branches, so that the loop using it can be vectorized.
+//
+
+static inline float FDAIBallAtan2(float y, float x)
+{
+	float ax = fabsf(x);
+	float ay = fabsf(y);
+	float mx = ax > ay ? ax : ay;
+	float mn = ax > ay ? ay : ax;
+	float a = mn / (mx + 1e-30f);
+	float s = a * a;
+	float r = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a + a;
+
+	r = ay > ax ? 0.5f * FDAIBALL_PI - r : r;
+	r = x < 0.0f ? FDAIBALL_PI - r : r;
+	return y < 0.0f ? -r : r;
+}
+
+static void FDAIBallMul(const double A[3][3], const double B[3][3], double C[3][3])
+{
+	for (int i = 0; i < 3; i++)
+		for (int j = 0; j < 3; j++)
+			C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j];
+}
+
+FDAIBall::FDAIBall() {
+
+	Width = 0;
+	Height = 0;
+	TexWidth = 0;
+	TexHeight = 0;
+}
+
+void FDAIBall::Init(int size, int x0, int y0, int width, int height) {
+
+	double tanfov = tan(FDAIBALL_FOV / 2.0 * FDAIBALL_PI / 180.0);
+	double lx, ly, lz, len;
+
+	Width = width;
+	Height = height;
+	Index.clear();
+	NX.clear();
+	NY.clear();
+	NZ.clear();
+	Shade.clear();
+
+	// Light direction in eye coordinates
+	len = sqrt(3.0);
+	lx = -1.0 / len;
+	ly = 1.0 / len;
+	lz = 1.0 / len;
+
+	for (int j = 0; j < height; j++) {
+		for (int i = 0; i < width; i++) {
+			double dx, dy, dz, b, disc, t, nx, ny, nz, ndotl, shade;
+
+			// View ray through the pixel center, the eye is at the origin looking down -z
+			dx = (2.0 * (x0 + i + 0.5) / size - 1.0) * tanfov;
+			dy = (1.0 - 2.0 * (y0 + j + 0.5) / size) * tanfov;
+			dz = -1.0;
+			len = sqrt(dx * dx + dy * dy + dz * dz);
+			dx /= len;
+			dy /= len;
+			dz /= len;
+
+			// Intersection with the ball centered at (0, 0, -DISTANCE)
+			b = -dz * FDAIBALL_DISTANCE;
+			disc = b * b - (FDAIBALL_DISTANCE * FDAIBALL_DISTANCE - FDAIBALL_RADIUS * FDAIBALL_RADIUS);
+			if (disc < 0.0)
+				continue;
+			t = b - sqrt(disc);
+
+			nx = t * dx / FDAIBALL_RADIUS;
+			ny = t * dy / FDAIBALL_RADIUS;
+			nz = (t * dz + FDAIBALL_DISTANCE) / FDAIBALL_RADIUS;
+
+			// Fixed function lighting as set up for the OpenGL ball: global ambient 0.2 and
+			// light ambient 1.0 with material ambient 0.2, diffuse 0.8 and specular 0.25. The
+			// shininess was never set, so the specular term has exponent 0 and is constant on the lit side
+			ndotl = nx * lx + ny * ly + nz * lz;
+			shade = 0.04 + 0.2;
+			if (ndotl > 0.0)
+				shade += 0.8 * ndotl + 0.25;
+			if (shade > 1.0)
+				shade = 1.0;
+
+			Index.push_back((j << 16) | i);
+			NX.push_back((float)nx);
+			NY.push_back((float)ny);
+			NZ.push_back((float)nz);
+			Shade.push_back((uint16_t)(shade * 256.0 + 0.5));
+		}
+	}
+
+	S.resize(Index.size());
+	T.resize(Index.size());
+}
+
+void FDAIBall::SetTexture(const unsigned char *bgr, int width, int height) {
+
+	TexWidth = width;
+	TexHeight = height;
+	Texture.resize(width * height);
+	for (int i = 0; i < width * height; i++) {
+		Texture[i] = bgr[3 * i] | (bgr[3 * i + 1] << 8) | (bgr[3 * i + 2] << 16);
+	}
+}
+
+void FDAIBall::Render(double roll, double pitch, double yaw, uint32_t *pixels, int pitch_px) {
+
+	double R1[3][3], R2[3][3], R[3][3];
+	double c, s;
+	float r00, r01, r02, r10, r11, r12, r20, r21, r22;
+	int n = (int)Index.size();
+
+	for (int j = 0; j < Height; j++)
+		memset(pixels + j * pitch_px, 0, Width * sizeof(uint32_t));
+
+	if (TexWidth == 0 || n == 0)
+		return;
+
+	//
+	// Same transformation as the old OpenGL modelview matrix:
+	// look at the ball from -y with z up, rotate by 90 deg plus roll about y, then pitch about x, then yaw about z.
+	//
+	const double L[3][3] = { { 1, 0, 0 }, { 0, 0, 1 }, { 0, -1, 0 } };
+
+	c = cos(FDAIBALL_PI / 2.0 + roll);
+	s = sin(FDAIBALL_PI / 2.0 + roll);
+	const double Ry[3][3] = { { c, 0, s }, { 0, 1, 0 }, { -s, 0, c } };
+	c = cos(pitch);
+	s = sin(pitch);
+	const double Rx[3][3] = { { 1, 0, 0 }, { 0, c, -s }, { 0, s, c } };
+	c = cos(yaw);
+	s = sin(yaw);
+	const double Rz[3][3] = { { c, -s, 0 }, { s, c, 0 }, { 0, 0, 1 } };
+
+	FDAIBallMul(L, Ry, R1);
+	FDAIBallMul(R1, Rx, R2);
+	FDAIBallMul(R2, Rz, R);
+
+	// Eye to ball coordinates is the transpose
+	r00 = (float)R[0][0]; r01 = (float)R[1][0]; r02 = (float)R[2][0];
+	r10 = (float)R[0][1]; r11 = (float)R[1][1]; r12 = (float)R[2][1];
+	r20 = (float)R[0][2]; r21 = (float)R[1][2]; r22 = (float)R[2][2];
+
+	const float *nx = &NX[0];
+	const float *ny = &NY[0];
+	const float *nz = &NZ[0];
+	float *ps = &S[0];
+	float *pt = &T[0];
+
+	// Texture coordinates of gluSphere: s = 1 - angle from +y towards +x / 2 pi, t = 1 - angle from +z / pi
+	for (int i = 0; i < n; i++) {
+		float x = r00 * nx[i] + r01 * ny[i] + r02 * nz[i];
+		float y = r10 * nx[i] + r11 * ny[i] + r12 * nz[i];
+		float z = r20 * nx[i] + r21 * ny[i] + r22 * nz[i];
+		float q = 1.0f - z * z;
+
+		q = q > 0.0f ? q : 0.0f;
+		ps[i] = 2.0f - FDAIBallAtan2(x, y) * (0.5f / FDAIBALL_PI);
+		pt[i] = 1.0f - FDAIBallAtan2(sqrtf(q), z) * (1.0f / FDAIBALL_PI);
+	}
+
+	const uint32_t *tex = &Texture[0];
+	const uint16_t *shade = &Shade[0];
+	const int *index = &Index[0];
+
+	for (int i = 0; i < n; i++) {
+		int u = (int)(ps[i] * TexWidth) % TexWidth;
+		int v = (int)(pt[i] * TexHeight);
+		if (v >= TexHeight) v = TexHeight - 1;
+		if (v < 0) v = 0;
+
+		uint32_t texel = tex[v * TexWidth + u];
+		uint32_t sh = shade[i];
+		uint32_t b = ((texel & 0xff) * sh) >> 8;
+		uint32_t g = (((texel >> 8) & 0xff) * sh) >> 8;
+		uint32_t r = (((texel >> 16) & 0xff) * sh) >> 8;
+		int p = index[i];
+
+		pixels[(p >> 16) * pitch_px + (p & 0xffff)] = b | (g << 8) | (r << 16);
+	}
+}
@@ -0,0 +1,73 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Software renderer for the FDAI attitude ball.
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+//
+// Renders the textured and lit FDAI ball into a 32 bit pixel buffer without any graphics API.
+// The view reproduces the old OpenGL setup: 45 degree perspective, ball radius 12 seen from 35 units.
+// Everything that doesn't depend on the attitude (view rays, surface normals, lighting) is computed
+// once in Init, so a frame is one rotation and one texture lookup per ball pixel.
+//
+
+class FDAIBall {
+
+public:
+	FDAIBall();
+
+	//
+	// Size is the width and height of the full square viewport in pixels. Only the window
+	// starting at x0, y0 with the given width and height is rendered.
+	//
+	void Init(int size, int x0, int y0, int width, int height);
+
+	//
+	// 24 bit texture in BMP layout (BGR, bottom row first), mapped onto the sphere like gluSphere does.
+	//
+	void SetTexture(const unsigned char *bgr, int width, int height);
+
+	//
+	// Renders the ball with the FDAI gimbal angles (radians) into a top-down 32 bit BGRX buffer,
+	// pitch is the buffer row length in pixels.
+	//
+	void Render(double roll, double pitch, double yaw, uint32_t *pixels, int pitch_px);
+
+	bool IsInitialized() { return Width > 0; };
+
+protected:
+	int Width;
+	int Height;
+
+	// Ball pixels, structure of arrays so that the per pixel loop can be vectorized
+	std::vector<int> Index;
+	std::vector<float> NX, NY, NZ;
+	std::vector<uint16_t> Shade;
+	std::vector<float> S, T;
+
+	std::vector<uint32_t> Texture;
+	int TexWidth;
+	int TexHeight;
+};
@@ -24,6 +24,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #include "Orbitersdk.h"
 #include "papi.h"
+#include "NamedObjects.h"
 #include "MechanicalAccelerometer.h"
 
 MechanicalAccelerometer::MechanicalAccelerometer()
@@ -155,7 +156,7 @@ MATRIX3 MechanicalAccelerometer::GetRotationMatrixZ(double angle) {
 VECTOR3 MechanicalAccelerometer::GetGravityVector()
 {
 	OBJHANDLE gravref = vessel->GetGravityRef();
-	OBJHANDLE hSun = oapiGetObjectByName("Sun");
+	OBJHANDLE hSun = NamedObjects::Sun();
 	VECTOR3 R, U_R;
 	vessel->GetRelativePos(gravref, R);
 	U_R = unit(R);
@@ -208,9 +209,9 @@ VECTOR3 MechanicalAccelerometer::GetGravityVector()
 	a_dP *= mu / pow(r, 2.0);
 	a_dP -= U_R_S * mu_S / pow(r_S, 2.0);
 
-	if (gravref == oapiGetObjectByName("Moon"))
+	if (gravref == NamedObjects::Moon())
 	{
-		OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+		OBJHANDLE hEarth = NamedObjects::Earth();
 
 		VECTOR3 R_Ea, U_R_E;
 		vessel->GetRelativePos(hEarth, R_Ea);
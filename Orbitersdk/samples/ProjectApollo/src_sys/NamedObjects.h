@@ -0,0 +1,71 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Cache of object and vessel handles looked up by name (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <string.h>
+#include <vector>
+#include <string>
+
+///
+/// Resolves celestial body names once instead of searching the Orbiter object list on
+/// every call. The handles are only valid for one simulation session, so every module
+/// calls Invalidate() in ovcInit when it creates its first vessel. Every module has its
+/// own cache, so nothing is shared between DLLs.
+///
+class NamedObjects
+{
+public:
+	/// Same as oapiGetObjectByName.
+	static OBJHANDLE Object(const char *name) { return Lookup(GetCache(), name); };
+
+	static OBJHANDLE Sun() { return Object("Sun"); };
+	static OBJHANDLE Earth() { return Object("Earth"); };
+	static OBJHANDLE Moon() { return Object("Moon"); };
+
+	/// Drops all cached handles at the start of a simulation session.
+	static void Invalidate() { GetCache().clear(); };
+
+protected:
+	struct Entry {
+		std::string name;
+		OBJHANDLE handle;
+	};
+
+	static std::vector<Entry> &GetCache() { static std::vector<Entry> cache; return cache; };
+
+	static OBJHANDLE Lookup(std::vector<Entry> &entries, const char *name)
+	{
+		// Only a few names are used, a linear search is fine
+		for (unsigned i = 0; i < entries.size(); i++) {
+			if (!strcmp(entries[i].name.c_str(), name))
+				return entries[i].handle;
+		}
+
+		Entry e;
+		e.name = name;
+		e.handle = oapiGetObjectByName((char *) name);
+		entries.push_back(e);
+		return e.handle;
+	};
+};
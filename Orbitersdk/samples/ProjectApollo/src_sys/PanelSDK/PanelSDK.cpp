@@ -267,8 +267,25 @@ void PanelSDK::Timestep(double time)
 
 void PanelSDK::SimpleTimestep(double simdt) 
 
+{
+	ThermalTimestep(simdt);
+	SystemsTimestep(simdt);
+}
+
+//
+// SimpleTimestep split in two, so that a vessel can step the slow radiative heat
+// exchange at a lower rate than the hydraulic and electric systems.
+//
+
+void PanelSDK::ThermalTimestep(double simdt)
+
 {
 	THERMAL->Radiative(simdt);
+}
+
+void PanelSDK::SystemsTimestep(double simdt)
+
+{
 	HYDRAULIC->Refresh(simdt);
 	ELECTRIC->Refresh(simdt);
 }
@@ -86,6 +86,8 @@ public:
 	void MFDEvent(int mfd);
 	void Timestep(double time);
 	void SimpleTimestep(double simdt);
+	void ThermalTimestep(double simdt);		// Radiative heat exchange only
+	void SystemsTimestep(double simdt);		// Hydraulic and electric systems only
 	void SetStage(int stage,int load);
 	void AddElectrical(e_object *e, bool can_delete);
 	void AddHydraulic(h_object *h);
@@ -0,0 +1,160 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Per frame spatial index of the vessel positions.
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+// To force orbitersdk.h to use <fstream> in any compiler version
+#pragma include_alias( <fstream.h>, <fstream> )
+#include "Orbitersdk.h"
+#include <math.h>
+#include <algorithm>
+
+#include "VesselProximity.h"
+
+// Grid cell size in meters. Vessels are mostly smaller, so one is in a few cells only.
+static const double PROXIMITY_CELL_SIZE = 1000.0;
+
+struct ProximityVessel {
+	OBJHANDLE hVessel;
+	VECTOR3 pos;
+	double size;
+	unsigned stamp;
+};
+
+struct ProximityCell {
+	unsigned long long key;
+	unsigned vessel;
+
+	bool operator<(const ProximityCell &c) const { return key < c.key; };
+};
+
+static std::vector<ProximityVessel> vessels;
+static std::vector<ProximityCell> cells;		// Sorted by key
+static double BuildSimt = -1.0;
+static DWORD BuildCount = 0;
+static unsigned QueryStamp = 0;
+static std::vector<unsigned> found;
+
+//
+// Cells far apart can get the same key, which only adds candidates to a query. The distance check sorts them out.
+//
+
+static inline unsigned long long CellKey(long long x, long long y, long long z)
+
+{
+	return ((unsigned long long) x * 73856093ULL) ^ ((unsigned long long) y * 19349663ULL) ^ ((unsigned long long) z * 83492791ULL);
+}
+
+static inline long long CellIndex(double x)
+
+{
+	return (long long) floor(x / PROXIMITY_CELL_SIZE);
+}
+
+void VesselProximity::Update()
+
+{
+	//
+	// Positions only change between frames. Vessels created or deleted during the
+	// frame change the count, then the grid is rebuilt as well.
+	//
+	if (oapiGetSimTime() != BuildSimt || oapiGetVesselCount() != BuildCount)
+		Build();
+}
+
+void VesselProximity::Build()
+
+{
+	BuildSimt = oapiGetSimTime();
+	BuildCount = oapiGetVesselCount();
+
+	vessels.resize(BuildCount);
+	cells.clear();
+
+	for (DWORD i = 0; i < BuildCount; i++) {
+		ProximityVessel &v = vessels[i];
+
+		v.hVessel = oapiGetVesselByIndex(i);
+		oapiGetGlobalPos(v.hVessel, &v.pos);
+		v.size = oapiGetSize(v.hVessel);
+		v.stamp = 0;
+
+		// All cells touched by the bounding sphere
+		long long x0 = CellIndex(v.pos.x - v.size), x1 = CellIndex(v.pos.x + v.size);
+		long long y0 = CellIndex(v.pos.y - v.size), y1 = CellIndex(v.pos.y + v.size);
+		long long z0 = CellIndex(v.pos.z - v.size), z1 = CellIndex(v.pos.z + v.size);
+
+		for (long long x = x0; x <= x1; x++) {
+			for (long long y = y0; y <= y1; y++) {
+				for (long long z = z0; z <= z1; z++) {
+					ProximityCell c;
+					c.key = CellKey(x, y, z);
+					c.vessel = i;
+					cells.push_back(c);
+				}
+			}
+		}
+	}
+
+	std::sort(cells.begin(), cells.end());
+	QueryStamp = 0;
+}
+
+void VesselProximity::Find(const VECTOR3 &p, double r, std::vector<OBJHANDLE> &result)
+
+{
+	result.clear();
+	found.clear();
+	Update();
+
+	// A vessel can be in several of the cells, only report it once
+	QueryStamp++;
+
+	long long x0 = CellIndex(p.x - r), x1 = CellIndex(p.x + r);
+	long long y0 = CellIndex(p.y - r), y1 = CellIndex(p.y + r);
+	long long z0 = CellIndex(p.z - r), z1 = CellIndex(p.z + r);
+
+	for (long long x = x0; x <= x1; x++) {
+		for (long long y = y0; y <= y1; y++) {
+			for (long long z = z0; z <= z1; z++) {
+				ProximityCell key;
+				key.key = CellKey(x, y, z);
+
+				std::vector<ProximityCell>::const_iterator it = std::lower_bound(cells.begin(), cells.end(), key);
+				for (; it != cells.end() && it->key == key.key; ++it) {
+					ProximityVessel &v = vessels[it->vessel];
+
+					if (v.stamp == QueryStamp)
+						continue;
+					v.stamp = QueryStamp;
+
+					if (dist(v.pos, p) < v.size + r)
+						found.push_back(it->vessel);
+				}
+			}
+		}
+	}
+
+	// Same order as scanning the vessel list
+	std::sort(found.begin(), found.end());
+	for (unsigned i = 0; i < found.size(); i++)
+		result.push_back(vessels[found[i]].hVessel);
+}
@@ -0,0 +1,44 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+
+  Per frame spatial index of the vessel positions (Header)
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+///
+/// Answers "which vessels are near this point" without every caller scanning the whole vessel
+/// list. The global positions and sizes of all vessels are put into a hashed grid once per frame,
+/// on the first query of that frame, and all further queries of the frame use the same grid.
+///
+class VesselProximity
+{
+public:
+	///
+	/// Vessels whose bounding sphere (oapiGetSize) comes closer than r to the global position p.
+	///
+	static void Find(const VECTOR3 &p, double r, std::vector<OBJHANDLE> &vessels);
+
+protected:
+	static void Update();
+	static void Build();
+};
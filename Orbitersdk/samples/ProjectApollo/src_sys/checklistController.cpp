@@ -28,6 +28,7 @@
 #include "Orbitersdk.h"
 #include <stdio.h>
 #include <math.h>
+#include <algorithm>
 #include "nasspdefs.h"
 #include "checklistController.h"
 #include "saturn.h"
@@ -287,15 +288,25 @@ bool ChecklistController::init(char *checkFile)
 	if (!init(true))
 		return false;
 
-	if (*checkFile == '\0') {
-		if (!file.Load(DefaultChecklistFile)) {
-			return false;
-		}
-	} else if (!file.Load(checkFile)) {
-		if (!file.Load(DefaultChecklistFile)) {
+	if (*checkFile == '\0' || !loadWorkbook(checkFile)) {
+		if (!loadWorkbook(DefaultChecklistFile)) {
 			return false;
 		}
 	}
+	spawnQueueValid = false;
+	return true;
+}
+
+bool ChecklistController::loadWorkbook(char *workbook)
+{
+	//Use the precompiled image if it matches the workbook
+	if (image.Open(workbook) && image.GetGroups(groups))
+		return true;
+	image.Close();
+	groups.clear();
+
+	if (!file.Load(workbook))
+		return false;
 
 	BasicExcelWorksheet* sheet;
 	vector<BasicExcelCell> cells;
@@ -318,9 +329,47 @@ bool ChecklistController::init(char *checkFile)
 			}
 		}
 	}
+
+	//Parse every group once and compile the image, so the next start doesn't need the workbook
+	vector<vector<ChecklistItem> > items(groups.size());
+	for (int i = 0; i < groups.size(); i++)
+		getGroupItems(groups[i], items[i]);
+	ChecklistImage::Compile(workbook, groups, items);
 	return true;
 }
 
+void ChecklistController::getGroupItems(const ChecklistGroup &program, vector<ChecklistItem> &set)
+{
+	if (image.IsOpen()) {
+		image.GetItems(program.group, set);
+		return;
+	}
+
+	BasicExcelWorksheet* sheet;
+	vector<BasicExcelCell> vec_temp;
+	sheet = file.GetWorksheet(program.name);
+	if (!sheet)
+		return;
+	int rows = sheet->GetTotalRows();
+	ChecklistItem temp;
+	for (int i = 1; i < rows; i++)
+	{
+		// Ignore empty texts
+		if (sheet->Cell(i,0)->GetString() != 0) {
+			for (int ii = 0; ii < 14; ii++)
+			{
+				vec_temp.push_back(*(sheet->Cell(i,ii)));
+			}
+			temp.init(vec_temp,groups);
+			temp.group = program.group;
+			temp.index = set.size();
+			set.push_back(temp);
+			vec_temp = vector<BasicExcelCell>();
+			temp = ChecklistItem();
+		}
+	}
+}
+
 bool ChecklistController::init(char *checkFile, bool SetFileName)
 {
 	if (SetFileName)
@@ -427,6 +476,7 @@ void ChecklistController::load(FILEHANDLE scn)
 		oapiReadScenario_nextline(scn,line);
 	}
 	init();
+	spawnQueueValid = false;
 }
 // Todo: Verify
 bool ChecklistController::autoExecute(bool input)
@@ -470,6 +520,7 @@ bool ChecklistController::init(bool input)
 	autoexecuteAllItemsAutomatic = false;
 	playSound = false;
 	waitForCompletion = false;
+	spawnQueueValid = false;
 
 	return true;
 }
@@ -670,7 +721,7 @@ bool ChecklistController::iterateChecklistItem(double missiontime, SaturnEvents
 bool ChecklistController::isDSKYChecklistItem() {
 	
 	if (active.program.group != -1) {
-		if (!stricmp(active.sequence->item, "DSKY")) {
+		if (active.sequence->type == CHECKLIST_ITEM_DSKY) {
 			return true;
 		}
 	}
@@ -680,7 +731,7 @@ bool ChecklistController::isDSKYChecklistItem() {
 bool ChecklistController::isDEDAChecklistItem() {
 
 	if (active.program.group != -1) {
-		if (!stricmp(active.sequence->item, "DEDA")) {
+		if (active.sequence->type == CHECKLIST_ITEM_DEDA) {
 			return true;
 		}
 	}
@@ -729,11 +780,84 @@ void ChecklistController::timestep(double missiontime, SaturnEvents eventControl
 	}
 
 	//Check for groups needing spawn
-	for (int i = 0; i < groups.size(); i++)	{
-		if (groups[i].autoSelect && !groups[i].called) {
-			if(groups[i].checkExec(lastMissionTime,eventController)) {
-				spawnCheck(i, false, true);
-			}
+	updateSpawnQueue(eventController);
+	while (!spawnQueue.empty() && spawnQueue.top().fireTime <= lastMissionTime) {
+		SpawnEntry e = spawnQueue.top();
+		spawnQueue.pop();
+		if (e.version == spawnVersion[e.group])
+			spawnDue.insert(lower_bound(spawnDue.begin(), spawnDue.end(), e.group), e.group);
+	}
+	for (int i = 0; i < spawnDue.size();) {
+		ChecklistGroup &group = groups[spawnDue[i]];
+		if (group.called || lastMissionTime - eventController.getTime(group.relativeEvent) - group.time > group.deadline) {
+			spawnDue.erase(spawnDue.begin() + i);
+			continue;
+		}
+		if (group.checkExec(lastMissionTime, eventController)) {
+			spawnCheck(spawnDue[i], false, true);
+		}
+		i++;
+	}
+}
+
+void ChecklistController::scheduleSpawn(int group)
+{
+	spawnVersion[group]++;
+	vector<int>::iterator it = lower_bound(spawnDue.begin(), spawnDue.end(), group);
+	if (it != spawnDue.end() && *it == group)
+		spawnDue.erase(it);
+
+	if (!groups[group].autoSelect || groups[group].called)
+		return;
+	double event = spawnEvents.getTime(groups[group].relativeEvent);
+	if (event == MINUS_INFINITY)
+		return;
+
+	SpawnEntry e;
+	e.fireTime = event + groups[group].time;
+	e.group = group;
+	e.version = spawnVersion[group];
+	spawnQueue.push(e);
+}
+
+void ChecklistController::updateSpawnQueue(SaturnEvents &eventController)
+{
+	int i, ev;
+
+	if (!spawnQueueValid) {
+		spawnQueue = priority_queue<SpawnEntry, vector<SpawnEntry>, greater<SpawnEntry> >();
+		spawnVersion.assign(groups.size(), 0);
+		spawnDue.clear();
+		spawnEvents = eventController;
+		for (ev = 0; ev <= SPLASHDOWN; ev++)
+			spawnGroupsByEvent[ev].clear();
+		for (i = 0; i < groups.size(); i++) {
+			if (groups[i].autoSelect && groups[i].relativeEvent > NO_TIME_DEF && groups[i].relativeEvent <= SPLASHDOWN)
+				spawnGroupsByEvent[groups[i].relativeEvent].push_back(i);
+			scheduleSpawn(i);
+		}
+		spawnQueueValid = true;
+		return;
+	}
+
+	//Only groups relative to an event whose time changed need a new entry. Several events can change
+	//in the same timestep (e.g. S-IVB and second stage staging), so compare all of them before taking over the new times.
+	bool changed[SPLASHDOWN + 1];
+	bool anyChanged = false;
+
+	for (ev = BACKUP_CREW_PRELAUNCH; ev <= SPLASHDOWN; ev++) {
+		changed[ev] = eventController.getTime((RelativeEvent)ev) != spawnEvents.getTime((RelativeEvent)ev);
+		if (changed[ev])
+			anyChanged = true;
+	}
+	if (!anyChanged)
+		return;
+
+	spawnEvents = eventController;
+	for (ev = BACKUP_CREW_PRELAUNCH; ev <= SPLASHDOWN; ev++) {
+		if (changed[ev]) {
+			for (i = 0; i < spawnGroupsByEvent[ev].size(); i++)
+				scheduleSpawn(spawnGroupsByEvent[ev][i]);
 		}
 	}
 }
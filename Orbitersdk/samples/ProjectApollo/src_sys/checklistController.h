@@ -41,6 +41,7 @@
 
 #include <vector>
 #include <deque>
+#include <queue>
 #include <string>
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
@@ -49,6 +50,7 @@
 #include "connector.h"
 #include "BasicExcelVC6.hpp"
 #include "soundlib.h"
+#include "ChecklistImage.h"
 using namespace std;
 using namespace YExcel;
 
@@ -93,6 +95,15 @@ enum RelativeEvent
 	SPLASHDOWN,
 };
 RelativeEvent checkEvent(const char*, bool Group=false);
+/// -------------------------------------------------------------
+/// What a checklist item operates, resolved when it is loaded.
+/// -------------------------------------------------------------
+enum ChecklistItemType
+{
+	CHECKLIST_ITEM_SWITCH = 0, /// < panel switch named in item
+	CHECKLIST_ITEM_DSKY, /// < sequence of DSKY keys
+	CHECKLIST_ITEM_DEDA, /// < sequence of DEDA keys
+};
 enum Status
 {
 	FAILED = -1,
@@ -195,11 +206,35 @@ struct ChecklistGroup
 	bool called;
 };
 
+class MFDConnector;
+class PanelSwitchItem;
+
+/// -------------------------------------------------------------
+/// Panel switch of a checklist item.  It is looked up by name
+/// the first time it is needed and again only after the vessel
+/// has set up its panel switches again.
+/// -------------------------------------------------------------
+struct ChecklistSwitch
+{
+	ChecklistSwitch()
+	{
+		item = 0;
+		version = 0;
+	};
+
+	PanelSwitchItem *get(MFDConnector *conn, char *name);
+
+	PanelSwitchItem *item;
+	unsigned version;
+};
+
 struct DSKYChecklistItem
 {
 	DSKYChecklistItem()
 	{
 		key[0] = 0;
+		item[0] = 0;
+		item2[0] = 0;
 	};
 
 	void init(char *k);
@@ -211,6 +246,8 @@ struct DSKYChecklistItem
 /// -------------------------------------------------------------
 	char item[100];
 	char item2[100];
+	ChecklistSwitch itemSwitch;
+	ChecklistSwitch item2Switch;
 };
 
 struct DEDAChecklistItem
@@ -218,6 +255,7 @@ struct DEDAChecklistItem
 	DEDAChecklistItem()
 	{
 		key[0] = 0;
+		item[0] = 0;
 	};
 
 	void init(char *k);
@@ -228,6 +266,7 @@ struct DEDAChecklistItem
 	/// spawn reference box
 	/// -------------------------------------------------------------
 	char item[100];
+	ChecklistSwitch itemSwitch;
 };
 
 ///
@@ -273,7 +312,6 @@ private:
 /// complete code.  In quickstart mode, the element will be
 /// switched automatically if enabled.
 /// -------------------------------------------------------------
-class MFDConnector;
 
 struct ChecklistItem
 {
@@ -365,6 +403,12 @@ struct ChecklistItem
 /// spawn reference box
 /// -------------------------------------------------------------
 	char item[100];
+	ChecklistSwitch itemSwitch;
+/// -------------------------------------------------------------
+/// Switch, DSKY or DEDA item, so that item doesn't need to be
+/// compared every time the checklist is iterated.
+/// -------------------------------------------------------------
+	ChecklistItemType type;
 /// -------------------------------------------------------------
 /// position the switch must be moved to.  Used for auto detect
 /// of checklist complete.
@@ -456,6 +500,8 @@ struct SaturnEvents
 	SaturnEvents();
 	void save(FILEHANDLE scn);
 	void load(FILEHANDLE scn);
+	/// Time of the given event, 0 for MISSION_TIME and MINUS_INFINITY if the event hasn't happened or isn't a time reference.
+	double getTime(RelativeEvent ev) const;
 
 	double BACKUP_CREW_PRELAUNCH;	// Time of backup crew ingress and prelaunch checks.
 	double PRIME_CREW_PRELAUNCH;	// Time of prime crew ingress and cabin closeout.
@@ -655,6 +701,40 @@ private:
 	bool isDSKYChecklistItem();
 	bool isDEDAChecklistItem();
 
+	///Loads the groups from the precompiled image of a workbook, or from the workbook itself
+	///and compiles the image for the next time.
+	bool loadWorkbook(char *workbook);
+	///Reads the items of a group from the image or the group's worksheet.
+	void getGroupItems(const ChecklistGroup &program, vector<ChecklistItem> &set);
+	///Precompiled image of the workbook, if one was found.
+	ChecklistImage image;
+
+	/// Entry of the auto spawn schedule. Entries are invalidated by bumping the group's
+	/// version instead of being removed from the heap.
+	struct SpawnEntry
+	{
+		double fireTime;
+		int group;
+		unsigned version;
+		bool operator>(const SpawnEntry &e) const { return fireTime > e.fireTime; };
+	};
+	///Auto select groups ordered by the mission time at which their spawn window opens.
+	priority_queue<SpawnEntry, vector<SpawnEntry>, greater<SpawnEntry> > spawnQueue;
+	///Current schedule version of each group.
+	vector<unsigned> spawnVersion;
+	///Groups with an open spawn window that haven't been called yet, sorted by group index.
+	vector<int> spawnDue;
+	///Auto select groups by the event they are relative to.
+	vector<int> spawnGroupsByEvent[SPLASHDOWN + 1];
+	///Event times the schedule was built with.
+	SaturnEvents spawnEvents;
+	///False if the groups changed and the schedule has to be rebuilt.
+	bool spawnQueueValid;
+	///(Re)inserts a group into the schedule.
+	void scheduleSpawn(int group);
+	///Rebuilds the schedule or reschedules the groups of events whose time changed.
+	void updateSpawnQueue(SaturnEvents &eventController);
+
 protected:	
 	/// Access to the vessels sound handler
 	SoundLib soundLib;
@@ -26,6 +26,7 @@
 // To force orbitersdk.h to use <fstream> in any compiler version
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "checklistController.h"
+#include "toggleswitch.h"
 
 // Code to make the compiler shut up.
 #pragma warning ( push )
@@ -93,6 +94,7 @@ ChecklistItem::ChecklistItem()
 	varlist[0] = 0;
 	automatic = false;
 	item[0] = 0;
+	type = CHECKLIST_ITEM_SWITCH;
 	position = 0;
 	guard = false;
 	hold = false;
@@ -206,6 +208,7 @@ void ChecklistItem::init(vector<BasicExcelCell> &cells, const vector<ChecklistGr
 				token = strtok(NULL, seps );
 			}
 			strcpy(item, "DSKY");
+			type = CHECKLIST_ITEM_DSKY;
 		}
 	}
 
@@ -225,50 +228,96 @@ void ChecklistItem::init(vector<BasicExcelCell> &cells, const vector<ChecklistGr
 				token = strtok(NULL, seps);
 			}
 			strcpy(item, "DEDA");
+			type = CHECKLIST_ITEM_DEDA;
 		}
 	}
 }
 
+PanelSwitchItem *ChecklistSwitch::get(MFDConnector *conn, char *name) {
+
+	unsigned v = conn->GetItemVersion();
+
+	if (v != version) {
+		item = conn->GetItem(name);
+		version = v;
+	}
+	return item;
+}
+
+// Panel item access through the resolved switch, items the panel doesn't know keep going through their name
+static int ChecklistSwitchState(MFDConnector *conn, char *name, ChecklistSwitch &s) {
+
+	PanelSwitchItem *p = s.get(conn, name);
+
+	if (p) {
+		return p->GetState();
+	}
+	return conn->GetState(name);
+}
+
+static bool ChecklistSwitchSetState(MFDConnector *conn, char *name, ChecklistSwitch &s, int value, bool guard = false, bool hold = false) {
+
+	PanelSwitchItem *p = s.get(conn, name);
+
+	if (p) {
+		PanelSwitches::SetItemState(p, value, guard, hold);
+		return true;
+	}
+	return conn->SetState(name, value, guard, hold);
+}
+
+static void ChecklistSwitchFlashing(MFDConnector *conn, char *name, ChecklistSwitch &s, bool flashing) {
+
+	PanelSwitchItem *p = s.get(conn, name);
+
+	if (p) {
+		p->SetFlashing(flashing);
+	}
+	else {
+		conn->SetFlashing(name, flashing);
+	}
+}
+
 void ChecklistItem::setFlashing(MFDConnector *conn, bool flashing) {
 
-	if (!stricmp(item, "DSKY")) {
+	if (type == CHECKLIST_ITEM_DSKY) {
 		if (dskyItemsSet.size() > 0) {
 			for (int i = 0; i < dskyItemsSet.size(); i++) {
-				conn->SetFlashing(dskyItemsSet[i].item, false);
-				conn->SetFlashing(dskyItemsSet[i].item2, false);
+				ChecklistSwitchFlashing(conn, dskyItemsSet[i].item, dskyItemsSet[i].itemSwitch, false);
+				ChecklistSwitchFlashing(conn, dskyItemsSet[i].item2, dskyItemsSet[i].item2Switch, false);
 			}
 			if (dskyNo & 1)
-				conn->SetFlashing(dskyItemsSet[dskyIndex].item, flashing);
+				ChecklistSwitchFlashing(conn, dskyItemsSet[dskyIndex].item, dskyItemsSet[dskyIndex].itemSwitch, flashing);
 			if (dskyNo & 2)
-				conn->SetFlashing(dskyItemsSet[dskyIndex].item2, flashing);
+				ChecklistSwitchFlashing(conn, dskyItemsSet[dskyIndex].item2, dskyItemsSet[dskyIndex].item2Switch, flashing);
 		}
 	} 
-	else if (!stricmp(item, "DEDA")) {
+	else if (type == CHECKLIST_ITEM_DEDA) {
 		if (dedaItemsSet.size() > 0) {
 			for (int i = 0; i < dedaItemsSet.size(); i++) {
-				conn->SetFlashing(dedaItemsSet[i].item, false);
+				ChecklistSwitchFlashing(conn, dedaItemsSet[i].item, dedaItemsSet[i].itemSwitch, false);
 			}
-			conn->SetFlashing(dedaItemsSet[dedaIndex].item, flashing);
+			ChecklistSwitchFlashing(conn, dedaItemsSet[dedaIndex].item, dedaItemsSet[dedaIndex].itemSwitch, flashing);
 		}
 	}
 	else {
-		conn->SetFlashing(item, flashing);
+		ChecklistSwitchFlashing(conn, item, itemSwitch, flashing);
 	}
 }
 
 bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 
 	if (!autoexec) {
-		if (!stricmp(item, "DSKY")) {
+		if (type == CHECKLIST_ITEM_DSKY) {
 			if (dskyItemsSet.size() > 0) {
 				if (!dskyPressed) {
-					if ((((dskyNo & 1) != 0) && conn->GetState(dskyItemsSet[dskyIndex].item) == position) ||
-						(((dskyNo & 2) != 0) && conn->GetState(dskyItemsSet[dskyIndex].item2) == position)) {
+					if ((((dskyNo & 1) != 0) && ChecklistSwitchState(conn, dskyItemsSet[dskyIndex].item, dskyItemsSet[dskyIndex].itemSwitch) == position) ||
+						(((dskyNo & 2) != 0) && ChecklistSwitchState(conn, dskyItemsSet[dskyIndex].item2, dskyItemsSet[dskyIndex].item2Switch) == position)) {
 						dskyPressed = true;
 					} 
 				} else {
-					if (conn->GetState(dskyItemsSet[dskyIndex].item) != position && 
-						conn->GetState(dskyItemsSet[dskyIndex].item2) != position) {
+					if (ChecklistSwitchState(conn, dskyItemsSet[dskyIndex].item, dskyItemsSet[dskyIndex].itemSwitch) != position && 
+						ChecklistSwitchState(conn, dskyItemsSet[dskyIndex].item2, dskyItemsSet[dskyIndex].item2Switch) != position) {
 						dskyPressed = false;
 						dskyIndex++;
 					}
@@ -278,15 +327,15 @@ bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 				dskyIndex = 0;
 				return true;
 			}
-		} else if (!stricmp(item, "DEDA")) {
+		} else if (type == CHECKLIST_ITEM_DEDA) {
 			if (dedaItemsSet.size() > 0) {
 				if (!dedaPressed) {
-					if (conn->GetState(dedaItemsSet[dedaIndex].item) == position){
+					if (ChecklistSwitchState(conn, dedaItemsSet[dedaIndex].item, dedaItemsSet[dedaIndex].itemSwitch) == position){
 						dedaPressed = true;
 					}
 				}
 				else {
-					if (conn->GetState(dedaItemsSet[dedaIndex].item) != position) {
+					if (ChecklistSwitchState(conn, dedaItemsSet[dedaIndex].item, dedaItemsSet[dedaIndex].itemSwitch) != position) {
 						dedaPressed = false;
 						dedaIndex++;
 					}
@@ -297,19 +346,19 @@ bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 				return true;
 			}
 		} else {
-			if (conn->GetState(item) == position) {
+			if (ChecklistSwitchState(conn, item, itemSwitch) == position) {
 				return true;
 			}
 		}
 	} else {
-		if (!stricmp(item, "DSKY")) {
+		if (type == CHECKLIST_ITEM_DSKY) {
 			if (dskyItemsSet.size() > 0) {
 				if (dskyNo & 1) {
-					if (conn->SetState(dskyItemsSet[dskyIndex].item, position)) {
+					if (ChecklistSwitchSetState(conn, dskyItemsSet[dskyIndex].item, dskyItemsSet[dskyIndex].itemSwitch, position)) {
 						dskyIndex++;
 					} 
 				} else {
-					if (conn->SetState(dskyItemsSet[dskyIndex].item2, position)) {
+					if (ChecklistSwitchSetState(conn, dskyItemsSet[dskyIndex].item2, dskyItemsSet[dskyIndex].item2Switch, position)) {
 						dskyIndex++;
 					} 
 				}
@@ -318,9 +367,9 @@ bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 				dskyIndex = 0;
 				return true;
 			}
-		} else if (!stricmp(item, "DEDA")) {
+		} else if (type == CHECKLIST_ITEM_DEDA) {
 			if (dedaItemsSet.size() > 0) {
-				if (conn->SetState(dedaItemsSet[dedaIndex].item, position)) {
+				if (ChecklistSwitchSetState(conn, dedaItemsSet[dedaIndex].item, dedaItemsSet[dedaIndex].itemSwitch, position)) {
 						dedaIndex++;
 					}
 			}
@@ -331,7 +380,7 @@ bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 		} else {
 			if (position == -1) {
 				return true;
-			} else if (conn->SetState(item, position, guard, hold)) {
+			} else if (ChecklistSwitchSetState(conn, item, itemSwitch, position, guard, hold)) {
 				return true;
 			}
 		}
@@ -341,16 +390,16 @@ bool ChecklistItem::iterate(MFDConnector *conn, bool autoexec) {
 
 double ChecklistItem::checkIterate(MFDConnector *conn) {
 
-	if (!stricmp(item, "DSKY")) {
+	if (type == CHECKLIST_ITEM_DSKY) {
 		return false;
 	}
-	if (!stricmp(item, "DEDA")) {
+	if (type == CHECKLIST_ITEM_DEDA) {
 		return false;
 	}
 	if (position == -1) {
 		return true;
 	}
-	if (conn->GetState(item) == position) {
+	if (ChecklistSwitchState(conn, item, itemSwitch) == position) {
 		return true;
 	}
 	return false;
@@ -359,14 +408,14 @@ double ChecklistItem::checkIterate(MFDConnector *conn) {
 
 double ChecklistItem::getAutoexecuteSlowDelay(MFDConnector *conn) {
 
-	if (!stricmp(item, "DSKY")) {
+	if (type == CHECKLIST_ITEM_DSKY) {
 		if (dskyIndex == 0) {
 			return 4;
 		} else {
 			return 1;
 		}
 	}
-	if (!stricmp(item, "DEDA")) {
+	if (type == CHECKLIST_ITEM_DEDA) {
 		if (dedaIndex == 0) {
 			return 4;
 		}
@@ -377,7 +426,7 @@ double ChecklistItem::getAutoexecuteSlowDelay(MFDConnector *conn) {
 	if (position == -1) {
 		return 2;
 	}
-	if (conn->GetState(item) == position) {
+	if (ChecklistSwitchState(conn, item, itemSwitch) == position) {
 		return 2;
 	}
 	return 4;
@@ -717,124 +766,12 @@ void ChecklistGroup::save(FILEHANDLE scn)
 // Todo: Verify
 bool ChecklistGroup::checkExec(double lastMissionTime,SaturnEvents &eventController)
 {
-	switch (relativeEvent)
-	{	
-	case MISSION_TIME:
-		if (time <= lastMissionTime && lastMissionTime - time <= deadline)
+	double event = eventController.getTime(relativeEvent);
+	if (event != MINUS_INFINITY)
+	{
+		double t = lastMissionTime - event;
+		if (time <= t && t - time <= deadline)
 			return true;
-		break;
-	case EARTH_ORBIT_INSERTION:
-		if (eventController.EARTH_ORBIT_INSERTION != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.EARTH_ORBIT_INSERTION;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case SPLASHDOWN:
-		if (eventController.SPLASHDOWN != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.SPLASHDOWN;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case BACKUP_CREW_PRELAUNCH:
-		if (eventController.BACKUP_CREW_PRELAUNCH != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.BACKUP_CREW_PRELAUNCH;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case PRIME_CREW_PRELAUNCH:
-		if (eventController.PRIME_CREW_PRELAUNCH != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.PRIME_CREW_PRELAUNCH;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case SECOND_STAGE_STAGING:
-		if (eventController.SECOND_STAGE_STAGING != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.SECOND_STAGE_STAGING;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case SIVB_STAGE_STAGING:
-		if (eventController.SIVB_STAGE_STAGING != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.SIVB_STAGE_STAGING;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case TOWER_JETTISON:
-		if (eventController.TOWER_JETTISON != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.TOWER_JETTISON;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case CSM_LV_SEPARATION_DONE:
-		if (eventController.CSM_LV_SEPARATION_DONE != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.CSM_LV_SEPARATION_DONE;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case CSM_LV_SEPARATION:
-		if (eventController.CSM_LV_SEPARATION != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.CSM_LV_SEPARATION;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case CM_SM_SEPARATION:
-		if (eventController.CM_SM_SEPARATION != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.CM_SM_SEPARATION;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case CM_SM_SEPARATION_DONE:
-		if (eventController.CM_SM_SEPARATION_DONE != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.CM_SM_SEPARATION_DONE;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case TLI:
-		if (eventController.TLI != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.TLI;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case TLI_DONE:
-		if (eventController.TLI_DONE != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.TLI_DONE;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
-	case PAYLOAD_EXTRACTION:
-		if (eventController.PAYLOAD_EXTRACTION != MINUS_INFINITY)
-		{
-			double t = lastMissionTime - eventController.PAYLOAD_EXTRACTION;
-			if (time <= t && t - time <= deadline)
-				return true;
-		}
-		break;
 	}
 	return false;
 }
@@ -884,27 +821,7 @@ void ChecklistContainer::operator=(const ChecklistContainer &input)
 // Todo: Verify
 void ChecklistContainer::initSet(const ChecklistGroup &program,vector<ChecklistItem> &set,ChecklistController &controller)
 {
-	BasicExcelWorksheet* sheet;
-	vector<BasicExcelCell> vec_temp;
-	sheet = controller.file.GetWorksheet(program.name);
-	int rows = sheet->GetTotalRows();
-	ChecklistItem temp;
-	for (int i = 1; i < rows; i++)
-	{
-		// Ignore empty texts
-		if (sheet->Cell(i,0)->GetString() != 0) {
-			for (int ii = 0; ii < 14; ii++)
-			{
-				vec_temp.push_back(*(sheet->Cell(i,ii)));
-			}
-			temp.init(vec_temp,controller.groups);
-			temp.group = program.group;
-			temp.index = set.size();
-			set.push_back(temp);
-			vec_temp = vector<BasicExcelCell>();
-			temp = ChecklistItem();		
-		}
-	}
+	controller.getGroupItems(program, set);
 }
 // Todo: Verify
 void ChecklistContainer::save(FILEHANDLE scn)
@@ -974,6 +891,45 @@ SaturnEvents::SaturnEvents()
 	PRIME_CREW_PRELAUNCH = SPLASHDOWN = EARTH_ORBIT_INSERTION = BACKUP_CREW_PRELAUNCH = SECOND_STAGE_STAGING = SIVB_STAGE_STAGING = TOWER_JETTISON = 
 		CSM_LV_SEPARATION_DONE = CSM_LV_SEPARATION = CM_SM_SEPARATION_DONE = CM_SM_SEPARATION = TLI = TLI_DONE = PAYLOAD_EXTRACTION = MINUS_INFINITY;
 }
+
+double SaturnEvents::getTime(RelativeEvent ev) const
+{
+	//The event names are qualified, the members of the same name hide them here
+	switch (ev)
+	{
+	case ::MISSION_TIME:
+		return 0.0;
+	case ::BACKUP_CREW_PRELAUNCH:
+		return BACKUP_CREW_PRELAUNCH;
+	case ::PRIME_CREW_PRELAUNCH:
+		return PRIME_CREW_PRELAUNCH;
+	case ::SECOND_STAGE_STAGING:
+		return SECOND_STAGE_STAGING;
+	case ::TOWER_JETTISON:
+		return TOWER_JETTISON;
+	case ::SIVB_STAGE_STAGING:
+		return SIVB_STAGE_STAGING;
+	case ::EARTH_ORBIT_INSERTION:
+		return EARTH_ORBIT_INSERTION;
+	case ::TLI:
+		return TLI;
+	case ::TLI_DONE:
+		return TLI_DONE;
+	case ::CSM_LV_SEPARATION:
+		return CSM_LV_SEPARATION;
+	case ::CSM_LV_SEPARATION_DONE:
+		return CSM_LV_SEPARATION_DONE;
+	case ::PAYLOAD_EXTRACTION:
+		return PAYLOAD_EXTRACTION;
+	case ::CM_SM_SEPARATION:
+		return CM_SM_SEPARATION;
+	case ::CM_SM_SEPARATION_DONE:
+		return CM_SM_SEPARATION_DONE;
+	case ::SPLASHDOWN:
+		return SPLASHDOWN;
+	}
+	return MINUS_INFINITY;
+}
 // Todo: Verify
 void SaturnEvents::save(FILEHANDLE scn)
 {
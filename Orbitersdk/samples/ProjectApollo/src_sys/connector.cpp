@@ -42,6 +42,8 @@ Connector::Connector()
 {
 	type = NO_CONNECTION;
 	connectedTo = 0;
+	slots = 0;
+	numSlots = 0;
 }
 
 Connector::~Connector()
@@ -120,6 +122,71 @@ ConnectorType Connector::GetType()
 	return type;
 }
 
+bool Connector::ReadRemoteSlot(unsigned int n, ConnectorMessageValue &v)
+
+{
+	if (!connectedTo || n >= connectedTo->numSlots)
+	{
+		return false;
+	}
+
+	ConnectorSlot &s = connectedTo->slots[n];
+
+	//
+	// Only use values from this timestep, otherwise the far end hasn't run yet
+	// and the message gets the current value.
+	//
+	if (s.version == 0 || s.time != oapiGetSimTime())
+	{
+		return false;
+	}
+
+	v = s.value;
+	return true;
+}
+
+void Connector::WriteSlot(unsigned int n, bool val, double simt)
+
+{
+	if (n < numSlots)
+	{
+		if (slots[n].version == 0 || slots[n].value.bValue != val)
+		{
+			slots[n].value.bValue = val;
+			slots[n].version++;
+		}
+		slots[n].time = simt;
+	}
+}
+
+void Connector::WriteSlot(unsigned int n, int val, double simt)
+
+{
+	if (n < numSlots)
+	{
+		if (slots[n].version == 0 || slots[n].value.iValue != val)
+		{
+			slots[n].value.iValue = val;
+			slots[n].version++;
+		}
+		slots[n].time = simt;
+	}
+}
+
+void Connector::WriteSlot(unsigned int n, double val, double simt)
+
+{
+	if (n < numSlots)
+	{
+		if (slots[n].version == 0 || slots[n].value.dValue != val)
+		{
+			slots[n].value.dValue = val;
+			slots[n].version++;
+		}
+		slots[n].time = simt;
+	}
+}
+
 MultiConnector::MultiConnector()
 
 {
@@ -100,6 +100,33 @@ struct ConnectorMessage
 	ConnectorMessageValue val4;
 };
 
+///
+/// A slot holds a value that one end of a connection publishes every timestep, so that the
+/// far end can read it directly instead of sending a message for it.
+///
+/// \ingroup Connectors
+/// \brief Published connector value.
+///
+struct ConnectorSlot
+{
+	ConnectorSlot() { value.dValue = 0.0; version = 0; time = 0.0; };
+
+	///
+	/// \brief Current value.
+	///
+	ConnectorMessageValue value;
+
+	///
+	/// \brief Incremented whenever the value changes, zero if it was never written.
+	///
+	unsigned int version;
+
+	///
+	/// \brief Simulation time of the last write.
+	///
+	double time;
+};
+
 ///
 /// \ingroup Connectors
 /// \brief Connector class. Specific connectors will be derived from this class.
@@ -170,16 +197,51 @@ public:
 	///
 	virtual bool ReceiveMessage(Connector *from, ConnectorMessage &m);
 
+	///
+	/// Read a value published by the far end of the connection. Only values written in the current
+	/// timestep are returned, so the caller gets the same result as from the equivalent message.
+	///
+	/// \brief Read slot from the far end.
+	/// \param n Slot number.
+	/// \param v Value of the slot.
+	/// \return False if the far end doesn't publish the slot or hasn't written it yet in this
+	/// timestep. Send the message instead in that case.
+	///
+	bool ReadRemoteSlot(unsigned int n, ConnectorMessageValue &v);
+
 	///
 	/// \brief Connector we're connected to, if any.
 	///
 	Connector *connectedTo;
 
 protected:
+	///
+	/// \brief Set the slots this end of the connection publishes.
+	/// \param s Slot array, owned by the derived connector.
+	/// \param n Number of slots.
+	///
+	void SetSlots(ConnectorSlot *s, unsigned int n) { slots = s; numSlots = n; };
+
+	///
+	/// \brief Write one of our published slots.
+	/// \param n Slot number.
+	/// \param val New value.
+	/// \param simt Current simulation time.
+	///
+	void WriteSlot(unsigned int n, bool val, double simt);
+	void WriteSlot(unsigned int n, int val, double simt);
+	void WriteSlot(unsigned int n, double val, double simt);
+
 	///
 	/// \brief Type of connection.
 	///
 	ConnectorType type;
+
+	///
+	/// \brief Published slots, if any.
+	///
+	ConnectorSlot *slots;
+	unsigned int numSlots;
 };
 
 ///
@@ -261,6 +323,8 @@ public:
 		MFD_PANEL_CHECKLIST_FLASHING,			///< Checklist item flashing.
 		MFD_PANEL_CHECKLIST_FLASHING_QUERY,		///< Checklist item flashing.
 		MFD_PANEL_GET_ITEM_FLASHING,			///< Get the item's current flashing.
+		MFD_PANEL_GET_ITEM,						///< Get the item itself.
+		MFD_PANEL_GET_ITEM_VERSION,				///< Get the version of the items returned by MFD_PANEL_GET_ITEM.
 	};
 
 	PanelConnector(PanelSwitches &p, ChecklistController &c);
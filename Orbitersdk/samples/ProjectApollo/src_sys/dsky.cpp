@@ -157,6 +157,10 @@ DSKY::DSKY(SoundLib &s, ApolloGuidance &computer, int IOChannel) : soundlib(s),
 
 {
 	DimmerRotationalSwitch = NULL;
+	DisplayVersion = 0;
+	PowerVersion = 0;
+	RedrawVersion = 0;
+	DisplayPowered = false;
 	Reset();
 	ResetKeyDown();
 	KeyCodeIOChannel = IOChannel;
@@ -198,6 +202,12 @@ void DSKY::Reset()
 	VerbFlashing = false;
 	NounFlashing = false;
 	ELOff = false;
+
+	// Channel words are at most 16 bits, so the next write to every row is processed
+	for (int i = 0; i < 16; i++)
+		LastRelayWord[i] = ~0u;
+
+	DisplayVersion++;
 }
 
 DSKY::~DSKY()
@@ -236,6 +246,26 @@ void DSKY::Timestep(double simt)
 		FirstTimeStep = false;
 	    soundlib.LoadSound(Sclick, BUTTON_SOUND);
 	}
+
+	//
+	// Switching the DSKY on or off changes the display without any channel write.
+	//
+
+	bool powered = IsPowered();
+	if (powered != DisplayPowered) {
+		DisplayPowered = powered;
+		DisplayVersion++;
+	}
+}
+
+bool DSKY::CheckRedraw()
+
+{
+	if (RedrawVersion == DisplayVersion)
+		return false;
+
+	RedrawVersion = DisplayVersion;
+	return true;
 }
 
 void DSKY::SystemTimestep(double simdt)
@@ -251,36 +281,44 @@ void DSKY::SystemTimestep(double simdt)
 	//
 
 	//
-	// Check the lights.
+	// The lights and segments only need to be counted again when the display changed.
 	//
 
-	LightsLit = 0;
-	if (UplinkLit()) LightsLit++;
-	if (NoAttLit()) LightsLit++;
-	if (StbyLit()) LightsLit++;
-	if (KbRelLit()) LightsLit++;
-	if (OprErrLit()) LightsLit++;
-	if (TempLit()) LightsLit++;
-	if (GimbalLockLit()) LightsLit++;
-	if (ProgLit()) LightsLit++;
-	if (RestartLit()) LightsLit++;
-	if (TrackerLit()) LightsLit++;
+	if (PowerVersion != DisplayVersion) {
+		PowerVersion = DisplayVersion;
 
-	//
-	// Check the segments
-	//
+		//
+		// Check the lights.
+		//
+
+		LightsLit = 0;
+		if (UplinkLit()) LightsLit++;
+		if (NoAttLit()) LightsLit++;
+		if (StbyLit()) LightsLit++;
+		if (KbRelLit()) LightsLit++;
+		if (OprErrLit()) LightsLit++;
+		if (TempLit()) LightsLit++;
+		if (GimbalLockLit()) LightsLit++;
+		if (ProgLit()) LightsLit++;
+		if (RestartLit()) LightsLit++;
+		if (TrackerLit()) LightsLit++;
+
+		//
+		// Check the segments
+		//
 
-	SegmentsLit = 6;
-	if (CompActy) 
-		SegmentsLit += 4;
+		SegmentsLit = 6;
+		if (CompActy) 
+			SegmentsLit += 4;
 
-	SegmentsLit += TwoDigitDisplaySegmentsLit(Prog, false, ELOff);
-	SegmentsLit += TwoDigitDisplaySegmentsLit(Verb, VerbFlashing, ELOff);
-	SegmentsLit += TwoDigitDisplaySegmentsLit(Noun, NounFlashing, ELOff);
+		SegmentsLit += TwoDigitDisplaySegmentsLit(Prog, false, ELOff);
+		SegmentsLit += TwoDigitDisplaySegmentsLit(Verb, VerbFlashing, ELOff);
+		SegmentsLit += TwoDigitDisplaySegmentsLit(Noun, NounFlashing, ELOff);
 
-	SegmentsLit += SixDigitDisplaySegmentsLit(R1, ELOff);
-	SegmentsLit += SixDigitDisplaySegmentsLit(R2, ELOff);
-	SegmentsLit += SixDigitDisplaySegmentsLit(R3, ELOff);
+		SegmentsLit += SixDigitDisplaySegmentsLit(R1, ELOff);
+		SegmentsLit += SixDigitDisplaySegmentsLit(R2, ELOff);
+		SegmentsLit += SixDigitDisplaySegmentsLit(R3, ELOff);
+	}
 
 	// 10 lights with together max. 6W, 184 segments with together max. 4W  
 	DrawPower((LightsLit * 0.6) + (SegmentsLit * 0.022));
@@ -894,6 +932,10 @@ void DSKY::LoadState(FILEHANDLE scn, char *end_str)
 	char *line;
 	int end_len = strlen (end_str);
 
+	for (int i = 0; i < 16; i++)
+		LastRelayWord[i] = ~0u;
+	DisplayVersion++;
+
 	while (oapiReadScenario_nextline (scn, line)) {
 		if (!strnicmp(line, end_str, end_len))
 			return;
@@ -942,6 +984,20 @@ void DSKY::LoadState(FILEHANDLE scn, char *end_str)
 	}
 }
 
+//
+// Packs the light and flashing state, to find out if a channel write changed anything.
+//
+
+unsigned DSKY::LightsState()
+
+{
+	return (CompActy ? 1 : 0) | (UplinkLight ? 2 : 0) | (NoAttLight ? 4 : 0) | (StbyLight ? 010 : 0) |
+		(KbRelLight ? 020 : 0) | (OprErrLight ? 040 : 0) | (TempLight ? 0100 : 0) | (GimbalLockLight ? 0200 : 0) |
+		(ProgLight ? 0400 : 0) | (RestartLight ? 01000 : 0) | (TrackerLight ? 02000 : 0) | (VelLight ? 04000 : 0) |
+		(AltLight ? 010000 : 0) | (PrioDispLight ? 020000 : 0) | (NoDAPLight ? 040000 : 0) |
+		(VerbFlashing ? 0100000 : 0) | (NounFlashing ? 0200000 : 0) | (ELOff ? 0400000 : 0);
+}
+
 //
 // I/O channel processing.
 //
@@ -951,6 +1007,7 @@ void DSKY::ProcessChannel11(ChannelValue val)
 
 {
 	ChannelValue val11;
+	unsigned lights = LightsState();
 
 	val11 = val;
 	SetCompActy(val11[LightComputerActivity]);
@@ -967,12 +1024,16 @@ void DSKY::ProcessChannel11(ChannelValue val)
 		ClearVerbDisplayFlashing();
 		ClearNounDisplayFlashing();
 	}*/
+
+	if (LightsState() != lights)
+		DisplayVersion++;
 }
 
 void DSKY::ProcessChannel163(ChannelValue val)
 
 {
 	ChannelValue val163;
+	unsigned lights = LightsState();
 
 	val163 = val;
 	SetTemp(val163[Ch163LightTemp]);
@@ -997,11 +1058,16 @@ void DSKY::ProcessChannel163(ChannelValue val)
 		ClearVerbDisplayFlashing();
 		ClearNounDisplayFlashing();
 	}
+
+	if (LightsState() != lights)
+		DisplayVersion++;
 }
 
 void DSKY::ProcessChannel11Bit(int bit, bool val)
 
 {
+	unsigned lights = LightsState();
+
 	//
 	// Channel 011 has bits to control the lights on the DSKY.
 	//
@@ -1045,6 +1111,9 @@ void DSKY::ProcessChannel11Bit(int bit, bool val)
 		SetOprErr(val);
 		break;*/
 	}
+
+	if (LightsState() != lights)
+		DisplayVersion++;
 }
 
 void DSKY::ProcessChannel10(ChannelValue val){
@@ -1053,6 +1122,16 @@ void DSKY::ProcessChannel10(ChannelValue val){
 
 	out_val.Value = val.to_ulong();
 
+	//
+	// The AGC rewrites relay rows that didn't change, only a different word changes the display.
+	//
+
+	if (LastRelayWord[out_val.Bits.a] == out_val.Value)
+		return;
+
+	LastRelayWord[out_val.Bits.a] = out_val.Value;
+	DisplayVersion++;
+
 	C1 = ValueChar(out_val.Bits.c);
 	C2 = ValueChar(out_val.Bits.d);
 
@@ -68,8 +68,8 @@ public:
 	// Set light status.
 	//
 
-	void LightStby()		{ StbyLight = true; };
-	void LightRestart()		{ RestartLight = true; };
+	void LightStby()		{ if (!StbyLight) { StbyLight = true; DisplayVersion++; } };
+	void LightRestart()		{ if (!RestartLight) { RestartLight = true; DisplayVersion++; } };
 
 	void SetUplink(bool val)		{ UplinkLight = val; };
 	void SetCompActy(bool val)		{ CompActy = val; };
@@ -87,8 +87,8 @@ public:
 	void SetPrioDisp(bool val)		{ PrioDispLight = val; };
 	void SetNoDAP(bool val)			{ NoDAPLight = val; };
 
-	void ClearStby()		{ StbyLight = false; };
-	void ClearRestart()		{ RestartLight = false; };
+	void ClearStby()		{ if (StbyLight) { StbyLight = false; DisplayVersion++; } };
+	void ClearRestart()		{ if (RestartLight) { RestartLight = false; DisplayVersion++; } };
 
 	//
 	// Flashing status.
@@ -107,6 +107,13 @@ public:
 	void Timestep(double simt);
 	void SystemTimestep(double simdt);
 
+	//
+	// Returns true once after the AGC changed the display or lights or the DSKY
+	// was switched on or off, so the panel areas only need to be redrawn then.
+	//
+
+	bool CheckRedraw();
+
 	//
 	// Keypad interface.
 	//
@@ -178,6 +185,19 @@ protected:
 	int LightsLit;
 	int SegmentsLit;
 
+	//
+	// Display change tracking. DisplayVersion is incremented on every change of
+	// the displayed state, the power draw and the redraw are only updated when
+	// their version differs. LastRelayWord holds the last word written to each
+	// channel 010 relay row.
+	//
+
+	unsigned DisplayVersion;
+	unsigned PowerVersion;
+	unsigned RedrawVersion;
+	bool DisplayPowered;
+	unsigned LastRelayWord[16];
+
 	//
 	// Lights state.
 	//
@@ -278,6 +298,7 @@ protected:
 	char ValueChar(unsigned val);
 	void KeyClick();
 	void ResetKeyDown();
+	unsigned LightsState();
 
 	void DSKYLightBlt(SURFHANDLE surf, SURFHANDLE lights, int dstx, int dsty, bool lit, int xOffset, int yOffset);
 	void DSKYKeyBlt(SURFHANDLE surf, SURFHANDLE keys, int dstx, int dsty, int srcx, int srcy, bool lit, int xOffset, int yOffset); 
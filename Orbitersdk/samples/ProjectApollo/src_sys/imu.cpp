@@ -43,6 +43,7 @@
 #include "saturn.h"
 #include "tracer.h"
 #include "papi.h"
+#include "NamedObjects.h"
 
 
 
@@ -667,7 +668,7 @@ double IMU::GetPIPATempF()
 VECTOR3 IMU::GetGravityVector()
 {
 	OBJHANDLE gravref = OurVessel->GetGravityRef();
-	OBJHANDLE hSun = oapiGetObjectByName("Sun");
+	OBJHANDLE hSun = NamedObjects::Sun();
 	VECTOR3 R, U_R;
 	OurVessel->GetRelativePos(gravref, R);
 	U_R = unit(R);
@@ -720,9 +721,9 @@ VECTOR3 IMU::GetGravityVector()
 	a_dP *= mu / pow(r, 2.0);
 	a_dP -= U_R_S * mu_S / pow(r_S, 2.0);
 
-	if (gravref == oapiGetObjectByName("Moon"))
+	if (gravref == NamedObjects::Moon())
 	{
-		OBJHANDLE hEarth = oapiGetObjectByName("Earth");
+		OBJHANDLE hEarth = NamedObjects::Earth();
 
 		VECTOR3 R_Ea, U_R_E;
 		OurVessel->GetRelativePos(hEarth, R_Ea);
@@ -29,6 +29,7 @@
 #include "Orbitersdk.h"
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 
 #include "resource.h"
 
@@ -53,6 +54,178 @@ static int nSoundsLoaded = 0;
 static SoundEvent soundevents[MAX_SOUND_EVENT];
 static int SoundEventLoaded = false;
 
+static bool LoadWaveFile(const char *filename, SoundClip &clip);
+static SoundClipCache soundcache(LoadWaveFile, SOUNDEVENT_CACHE_SIZE);
+
+SoundClipCache::SoundClipCache(Decoder d, size_t max) :
+	decoder(d),
+	maxbytes(max),
+	bytes(0),
+	hThread(NULL),
+	quit(false)
+
+{
+}
+
+SoundClipCache::~SoundClipCache()
+
+{
+	Shutdown();
+}
+
+DWORD WINAPI SoundClipCache::ThreadEntry(void *arg)
+
+{
+	((SoundClipCache *) arg)->Run();
+	return 0;
+}
+
+void SoundClipCache::Prefetch(const char *filename)
+
+{
+	bool threaded;
+
+	{
+		Lock lock(mutex);
+
+		for (std::list<std::shared_ptr<SoundClip> >::iterator it = clips.begin(); it != clips.end(); ++it)
+		{
+			if ((*it)->filename == filename)
+				return;
+		}
+		if (std::find(queue.begin(), queue.end(), filename) != queue.end())
+			return;
+
+		if (hThread == NULL)
+		{
+			quit = false;
+			hThread = CreateThread(NULL, 0, ThreadEntry, this, 0, NULL);
+		}
+
+		threaded = (hThread != NULL);
+		if (threaded)
+			queue.push_back(filename);
+	}
+
+	if (threaded)
+	{
+		wakeup.Raise();
+		return;
+	}
+
+	//
+	// No worker thread, so decode it right here.
+	//
+	std::shared_ptr<SoundClip> clip(new SoundClip());
+	clip->filename = filename;
+	clip->valid = decoder(filename, *clip);
+
+	Lock lock(mutex);
+	Insert(clip);
+}
+
+std::shared_ptr<SoundClip> SoundClipCache::Find(const char *filename)
+
+{
+	{
+		Lock lock(mutex);
+
+		for (std::list<std::shared_ptr<SoundClip> >::iterator it = clips.begin(); it != clips.end(); ++it)
+		{
+			if ((*it)->filename == filename)
+			{
+				std::shared_ptr<SoundClip> clip = *it;
+
+				// Now the most recently used one
+				clips.erase(it);
+				clips.push_back(clip);
+				return clip;
+			}
+		}
+	}
+
+	Prefetch(filename);
+	return std::shared_ptr<SoundClip>();
+}
+
+void SoundClipCache::Shutdown()
+
+{
+	HANDLE h;
+
+	{
+		Lock lock(mutex);
+		h = hThread;
+		quit = true;
+	}
+
+	if (h != NULL)
+	{
+		wakeup.Raise();
+		WaitForSingleObject(h, INFINITE);
+		CloseHandle(h);
+	}
+
+	Lock lock(mutex);
+	hThread = NULL;
+	quit = false;
+	queue.clear();
+	clips.clear();
+	bytes = 0;
+}
+
+//
+// Called with the mutex held.
+//
+
+void SoundClipCache::Insert(std::shared_ptr<SoundClip> clip)
+
+{
+	bytes += clip->data.size();
+	clips.push_back(clip);
+
+	//
+	// Drop the least recently used clips, but always keep the new one. Clips still
+	// being played are kept alive by their shared pointer.
+	//
+	while (bytes > maxbytes && clips.size() > 1)
+	{
+		bytes -= clips.front()->data.size();
+		clips.pop_front();
+	}
+}
+
+void SoundClipCache::Run()
+
+{
+	for (;;)
+	{
+		std::string filename;
+
+		{
+			Lock lock(mutex);
+			if (quit)
+				return;
+			if (!queue.empty())
+				filename = queue.front();
+		}
+
+		if (filename.empty())
+		{
+			wakeup.Wait();
+			continue;
+		}
+
+		std::shared_ptr<SoundClip> clip(new SoundClip());
+		clip->filename = filename;
+		clip->valid = decoder(filename.c_str(), *clip);
+
+		Lock lock(mutex);
+		queue.pop_front();
+		Insert(clip);
+	}
+}
+
 // MODIF x15 to manage landing mission sound
 SoundEvent::SoundEvent()
 
@@ -64,6 +237,11 @@ SoundEvent::SoundEvent()
 	lastplayed=-1;
     SoundEventLoaded =false;
 
+	pending = false;
+	pendingfile[0] = 0;
+	pendingoffset = 0.0;
+	prefetched = -2;
+
 	apDSBuffer = 0;
 }
 
@@ -119,6 +297,18 @@ int SoundEvent::play(SoundLib soundlib,
     if (!isValid())
 		return(false);
 
+	PrefetchAhead();
+
+	//
+	// The clip of the last event wasn't decoded yet when it was due, start it
+	// as soon as it is.
+	//
+	if (pending)
+	{
+		PlaySound(pendingfile, true, pendingoffset);
+		return(false);
+	}
+
 	// is Sound still playing ?
 	// if yes let it play
 
@@ -319,6 +509,34 @@ int SoundEvent::play(SoundLib soundlib,
 	return 1;
 }
 
+//
+// Queue the wave files of the next few events for decoding, whenever a new event has been played.
+//
+
+void SoundEvent::PrefetchAhead()
+
+{
+	int n = 0;
+
+	if (prefetched == lastplayed)
+		return;
+
+	prefetched = lastplayed;
+	for (int i = lastplayed + 1; i < nSoundsLoaded && n < SOUNDEVENT_PREFETCH; i++)
+	{
+		if (soundevents[i].filenames[0])
+		{
+			soundcache.Prefetch(soundevents[i].filenames);
+			n++;
+		}
+	}
+}
+
+bool SoundEvent::EarlierMET(const SoundEvent &a, const SoundEvent &b)
+
+{
+	return a.met < b.met;
+}
 
 int SoundEvent::LoadMissionLandingSoundArray(SoundLib soundlib,char *soundname)
 
@@ -351,6 +569,7 @@ int SoundEvent::LoadMissionLandingSoundArray(SoundLib soundlib,char *soundname)
 
  
 	lastplayed =-1;
+	prefetched = -2;
 	TRACESETUP("LOAD MISSION SOUND ARRAY");
 
 //	if (!OrbiterSoundActive)
@@ -575,6 +794,7 @@ TRACE(SoundPath);
 
 	fclose(fp);
     soundevents[indice].met = 0;
+	nSoundsLoaded = indice;
 
     /* now interpolate altitude information */
 
@@ -636,6 +856,7 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 		return true;
 
 	lastplayed =-1;
+	prefetched = -2;
 	TRACESETUP("LOAD MISSION SOUND ARRAY");
 
 //	if (!OrbiterSoundActive)
@@ -736,6 +957,12 @@ int SoundEvent::LoadMissionTimeSoundArray(SoundLib soundlib, char *soundname, do
 	}
 
 	fclose(fp);
+
+	//
+	// Events are played in order of the table, so sort it by MET in case the
+	// file isn't.
+	//
+	std::stable_sort(soundevents, soundevents + indice, EarlierMET);
     soundevents[indice].met = MINUS_INFINITY;
 
 	nSoundsLoaded = indice;
@@ -799,312 +1026,211 @@ int SoundEvent::InitDirectSound(SoundLib soundlib)
     return(true);
 }
 
-int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
-{
-    HMMIO m_hmmio;
-    HRESULT hr;
-
-    TRACESETUP("PLAYSOUND");
-
-	if(newbuffer)
-	{
-
-	m_hmmio = mmioOpen( filenames, NULL, MMIO_ALLOCBUF | MMIO_READ );
+//
+// Reads the format and sample data of an open wave file.
+//
 
-	if( NULL == m_hmmio )
-	{
-		TRACE ("DIRECT SOUND ERROR MMIOOPEN");
-		return (false);
-	}
+static bool ReadWaveFile(HMMIO hmmio, SoundClip &clip)
 
+{
+    MMCKINFO        ckRiff;         // Use in opening a WAVE file
     MMCKINFO        ckIn;           // chunk info. for general use.
+    MMCKINFO        ck;             // 'data' chunk
     PCMWAVEFORMAT   pcmWaveFormat;  // Temp PCM structure to load in.
+    WORD            cbExtraBytes = 0;
 
-	WAVEFORMATEX* m_pwfx;        // Pointer to WAVEFORMATEX structure
-    MMCKINFO      m_ck;          // Multimedia RIFF chunk
-    MMCKINFO      m_ckRiff;      // Use in opening a WAVE file
-    DWORD         m_dwSize;      // The size of the wave file
-    MMIOINFO      m_mmioinfoOut;
-    DWORD         m_dwFlags;
-
-#define WAVEFILE_READ   1
-#define WAVEFILE_WRITE  2
-	
-	
-	   m_pwfx = NULL;
-
-    if( ( 0 != mmioDescend( m_hmmio, &m_ckRiff, NULL, 0 ) ) )
-	{
-        TRACE ("DIRECT SOUND ERROR MMIODESCEND");
-		return (false);
-	}
+    if( 0 != mmioDescend( hmmio, &ckRiff, NULL, 0 ) )
+        return(false);
 
     // Check to make sure this is a valid wave file
-    if( (m_ckRiff.ckid != FOURCC_RIFF) ||
-        (m_ckRiff.fccType != mmioFOURCC('W', 'A', 'V', 'E') ) )
-	{
-		return(false);
-        TRACE ("DIRECT SOUND ERROR MMIOFOURCC");
-	}
+    if( (ckRiff.ckid != FOURCC_RIFF) ||
+        (ckRiff.fccType != mmioFOURCC('W', 'A', 'V', 'E') ) )
+        return(false);
 
     // Search the input file for for the 'fmt ' chunk.
     ckIn.ckid = mmioFOURCC('f', 'm', 't', ' ');
-    if( 0 != mmioDescend( m_hmmio, &ckIn, &m_ckRiff, MMIO_FINDCHUNK ) )
-	{
-        TRACE("DIRECT SOUND ERROR MMIDESCENT FIND CHUNK");
-		return(false);
-	}
+    if( 0 != mmioDescend( hmmio, &ckIn, &ckRiff, MMIO_FINDCHUNK ) )
+        return(false);
 
     // Expect the 'fmt' chunk to be at least as large as <PCMWAVEFORMAT>;
     // if there are extra parameters at the end, we'll ignore them
     if( ckIn.cksize < (LONG) sizeof(PCMWAVEFORMAT) )
-	{
-        TRACE ("DIRECT SOUND ERROR CHUNKSIZE");
-		return(false);
-	}
+        return(false);
 
     // Read the 'fmt ' chunk into <pcmWaveFormat>.
-    if( mmioRead( m_hmmio, (HPSTR) &pcmWaveFormat,
+    if( mmioRead( hmmio, (HPSTR) &pcmWaveFormat,
                   sizeof(pcmWaveFormat)) != sizeof(pcmWaveFormat) )
-	{
-        TRACE ("DIRECT SOUND ERROR MMIOREAD");
-		return(false);
-	}
+        return(false);
 
-    // Allocate the waveformatex, but if its not pcm format, read the next
-    // word, and thats how many extra bytes to allocate.
-    if( pcmWaveFormat.wf.wFormatTag == WAVE_FORMAT_PCM )
+    // If it's not pcm format, read the next word, and thats how many extra bytes to allocate.
+    if( pcmWaveFormat.wf.wFormatTag != WAVE_FORMAT_PCM )
     {
-        m_pwfx = (WAVEFORMATEX*)new CHAR[ sizeof(WAVEFORMATEX) ];
-        if( NULL == m_pwfx )
-		{
-            TRACE("DIRECT SOUND ERROR ALLOC");
-			return(false);
-		}
-
-        // Copy the bytes from the pcm structure to the waveformatex structure
-        memcpy( m_pwfx, &pcmWaveFormat, sizeof(pcmWaveFormat) );
-        m_pwfx->cbSize = 0;
+        if( mmioRead( hmmio, (CHAR*)&cbExtraBytes, sizeof(WORD)) != sizeof(WORD) )
+            return(false);
     }
-    else
-    {
-        // Read in length of extra bytes.
-        WORD cbExtraBytes = 0L;
-        if( mmioRead( m_hmmio, (CHAR*)&cbExtraBytes, sizeof(WORD)) != sizeof(WORD) )
-		{
-            TRACE ("DIRECT SOUND ERROR M_HMMIO");
-			return(false);
-		}
 
-        m_pwfx = (WAVEFORMATEX*)new CHAR[ sizeof(WAVEFORMATEX) + cbExtraBytes ];
-        if( NULL == m_pwfx )
-		{
-            TRACE("DIRECT SOUND ERREOR ALLOC 2");
-			return(false);
-		}
+    // Copy the bytes from the pcm structure to the waveformatex structure
+    clip.format.resize( sizeof(WAVEFORMATEX) + cbExtraBytes );
+    WAVEFORMATEX *pwfx = (WAVEFORMATEX *) &clip.format[0];
+    memcpy( pwfx, &pcmWaveFormat, sizeof(pcmWaveFormat) );
+    pwfx->cbSize = cbExtraBytes;
 
-        // Copy the bytes from the pcm structure to the waveformatex structure
-        memcpy( m_pwfx, &pcmWaveFormat, sizeof(pcmWaveFormat) );
-        m_pwfx->cbSize = cbExtraBytes;
-
-        // Now, read those extra bytes into the structure, if cbExtraAlloc != 0.
-        if( mmioRead( m_hmmio, (CHAR*)(((BYTE*)&(m_pwfx->cbSize))+sizeof(WORD)),
-                      cbExtraBytes ) != cbExtraBytes )
-        {
-            //SAFE_DELETE( m_pwfx );
-            TRACE("DIRECT SOUND ERROR MMIOREAD2");
-			return(false);
-        }
-    }
+    // Now, read those extra bytes into the structure, if cbExtraAlloc != 0.
+    if( cbExtraBytes > 0 &&
+        mmioRead( hmmio, (CHAR*) &clip.format[sizeof(WAVEFORMATEX)], cbExtraBytes ) != cbExtraBytes )
+        return(false);
 
     // Ascend the input file out of the 'fmt ' chunk.
-    if( 0 != mmioAscend( m_hmmio, &ckIn, 0 ) )
-    {
-        //SAFE_DELETE( m_pwfx );
-        TRACE("DIRECT SOUND ERROR MMIOASCEND");
-		return(false);
-    }
-
-	TRACE("DIRECTSOUND READMMIO OK");
-
-
+    if( 0 != mmioAscend( hmmio, &ckIn, 0 ) )
+        return(false);
 
-    m_dwFlags = WAVEFILE_READ;
+    // Seek to the data
+    if( -1 == mmioSeek( hmmio, ckRiff.dwDataOffset + sizeof(FOURCC), SEEK_SET ) )
+        return(false);
 
-        if( m_dwFlags == WAVEFILE_READ )
-        {
-            // Seek to the data
-            if( -1 == mmioSeek( m_hmmio, m_ckRiff.dwDataOffset + sizeof(FOURCC),
-                            SEEK_SET ) )
-			{
-                TRACE ("DIRECT SOUND ERROR MMIOSEEK");
-				return(false);
-			}
+    // Search the input file for the 'data' chunk.
+    ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
+    if( 0 != mmioDescend( hmmio, &ck, &ckRiff, MMIO_FINDCHUNK ) )
+        return(false);
 
-            // Search the input file for the 'data' chunk.
-            m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-            if( 0 != mmioDescend( m_hmmio, &m_ck, &m_ckRiff, MMIO_FINDCHUNK ) )
-			{
-                 TRACE ("DIRECT SOUND ERROR MMIODESCEND");
-				 return(false);
-			}
-        }
-        else
-        {
-            // Create the 'data' chunk that holds the waveform samples.
-            m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-            m_ck.cksize = 0;
+    // Read all of the samples in one go.
+    clip.data.resize( ck.cksize );
+    if( ck.cksize == 0 ||
+        mmioRead( hmmio, (HPSTR) &clip.data[0], ck.cksize ) != (LONG) ck.cksize )
+        return(false);
 
-            if( 0 != mmioCreateChunk( m_hmmio, &m_ck, 0 ) )
-			{
-                TRACE("DIRECT SOUND ERROR MMIOCREATECHUNK");
-				return(false);
-			}
+    return(true);
+}
 
-            if( 0 != mmioGetInfo( m_hmmio, &m_mmioinfoOut, 0 ) )
-			{
-                TRACE ("DIRECT SOUND ERROR MMMIOGETINFO");
-				return(false);
-			}
-		}
-  
+//
+// Decoder of the sound clip cache, runs on its worker thread.
+//
 
-	TRACE("DIRECTSOUND RESETFILE OK");
+static bool LoadWaveFile(const char *filename, SoundClip &clip)
 
- 
-    // After the reset, the size of the wav file is m_ck.cksize so store it now
-    m_dwSize = m_ck.cksize;
+{
+    HMMIO hmmio;
+    bool ok;
 
+    hmmio = mmioOpen( (LPSTR) filename, NULL, MMIO_ALLOCBUF | MMIO_READ );
+    if( NULL == hmmio )
+        return(false);
 
-    char buffers[80];
+    ok = ReadWaveFile( hmmio, clip );
+    mmioClose( hmmio, 0 );
 
-	TRACE ("DIRECTSOUND TAILLE BUFFER");
-	sprintf(buffers,"%d", m_dwSize);
-	TRACE (buffers);
+    if (!ok)
+    {
+        clip.format.clear();
+        clip.data.clear();
+    }
+    return(ok);
+}
 
+bool SoundEvent::CreateBuffer(const SoundClip &clip)
 
-    DWORD                dwDSBufferSize = NULL;
+{
+    HRESULT hr;
 
+    TRACESETUP("CREATEBUFFER");
 
+    ReleaseBuffer();
 
     apDSBuffer = new LPDIRECTSOUNDBUFFER[1];
-    if( apDSBuffer == NULL )
-    {
-        TRACE("ERROR DIRECTSOUND NEW BUFFER");
-		return(false);
-    }
-
-    // Make the DirectSound buffer the same size as the wav file
-    dwDSBufferSize = m_dwSize;
+    apDSBuffer[0] = NULL;
 
-    // Create the direct sound buffer, and only request the flags needed
-    // since each requires some overhead and limits if the buffer can
-    // be hardware accelerated
-    DSBUFFERDESC dsbd2;
-    ZeroMemory( &dsbd2, sizeof(DSBUFFERDESC) );
-    dsbd2.dwSize          = sizeof(DSBUFFERDESC);
-    dsbd2.dwFlags         = 0;
-    dsbd2.dwBufferBytes   = dwDSBufferSize;
-    dsbd2.guid3DAlgorithm = GUID_NULL;
-    dsbd2.lpwfxFormat     = m_pwfx;
-
-TRACE ("APPEL CREATE SOUND BUFFER");
+    // Create the direct sound buffer the same size as the wav file, and only
+    // request the flags needed since each requires some overhead and limits
+    // if the buffer can be hardware accelerated
+    DSBUFFERDESC dsbd;
+    ZeroMemory( &dsbd, sizeof(DSBUFFERDESC) );
+    dsbd.dwSize          = sizeof(DSBUFFERDESC);
+    dsbd.dwFlags         = 0;
+    dsbd.dwBufferBytes   = (DWORD) clip.data.size();
+    dsbd.guid3DAlgorithm = GUID_NULL;
+    dsbd.lpwfxFormat     = (WAVEFORMATEX *) &clip.format[0];
 
     // DirectSound is only guarenteed to play PCM data.  Other
     // formats may or may not work depending the sound card driver.
-    hr = m_pDS->CreateSoundBuffer( &dsbd2, &apDSBuffer[0], NULL );
+    hr = m_pDS->CreateSoundBuffer( &dsbd, &apDSBuffer[0], NULL );
     if (hr != DS_OK)
-	    TRACE ("ERROR DIRECTSOUND CREATE SOUND BUFFER")
-	else TRACE("DIRECTSOUND CREATE SOUND BUFFER OK");
-
-
-	
-
-    // Make sure we have focus, and we didn't just switch in from
-    // an app which had a DirectSound device
-
-//    hr = RestoreBuffer( &apDSBuffer[0], NULL );
-//    if (hr != DS_OK)
-//	    TRACE ("ERROR DIRECTSOUND RESTORE SOUND BUFFER")
-//	else TRACE("DIRECTSOUND RESTORE SOUND BUFFER OK");
-
-
+    {
+        TRACE ("ERROR DIRECTSOUND CREATE SOUND BUFFER");
+        ReleaseBuffer();
+        return(false);
+    }
 
-    // Lock the buffer down
-    hr = apDSBuffer[0]->Lock( 0, m_dwSize,
+    // Copy the samples and unlock the buffer again before playing it
+    hr = apDSBuffer[0]->Lock( 0, dsbd.dwBufferBytes,
                      &pDSLockedBuffer, &dwDSLockedBufferSize,
                      NULL, NULL, 0L );
     if (hr != DS_OK)
-		 TRACE ("ERROR DIRECTSOUND LOCK")
-	else TRACE ("DIRECTSOUND LOCK OK");
-
-    // Reset the wave file to the beginning
-
-
-    // Seek to the data
-    if( -1 == mmioSeek( m_hmmio, m_ckRiff.dwDataOffset + sizeof(FOURCC),
-                            SEEK_SET ) )
-         TRACE ("ERROR DIRECTSOUND MMIOSEEK")
-	else TRACE ("DIRECTSOUND MMIOSSEEK OK");
-
-    // Search the input file for the 'data' chunk.
-    m_ck.ckid = mmioFOURCC('d', 'a', 't', 'a');
-    if( 0 != mmioDescend( m_hmmio, &m_ck, &m_ckRiff, MMIO_FINDCHUNK ) )
-         TRACE ("ERROR DIRECTSOUND MMIODESCEND")
-	else TRACE ("DIRECTSOUND MMIODESCEND OK");
-
-
-
-    MMIOINFO mmioinfoIn; // current status of m_hmmio
-    DWORD   dwWavDataRead        = 0;    // Amount of data read from the wav file
-
+    {
+        TRACE ("ERROR DIRECTSOUND LOCK");
+        ReleaseBuffer();
+        return(false);
+    }
 
-    dwWavDataRead = 0;
+    if (dwDSLockedBufferSize > dsbd.dwBufferBytes)
+        dwDSLockedBufferSize = dsbd.dwBufferBytes;
+    memcpy( pDSLockedBuffer, &clip.data[0], dwDSLockedBufferSize );
+    apDSBuffer[0]->Unlock( pDSLockedBuffer, dwDSLockedBufferSize, NULL, 0 );
+    pDSLockedBuffer = NULL;
 
-    if( 0 != mmioGetInfo( m_hmmio, &mmioinfoIn, 0 ) )
-         TRACE ("ERROR DIRECTSOUND MMIOGETINFO")
-	else TRACE ("DIRECTSOUND MMIOGETINFO OK");
-        
+    return(true);
+}
 
-    UINT cbDataIn = m_dwSize;
-    if( cbDataIn > m_ck.cksize )
-        cbDataIn = m_ck.cksize;
+void SoundEvent::ReleaseBuffer()
 
-    m_ck.cksize -= cbDataIn;
+{
+    if (apDSBuffer == NULL)
+        return;
 
-    for( DWORD cT = 0; cT < cbDataIn; cT++ )
+    if (apDSBuffer[0] != NULL)
     {
-            // Copy the bytes from the io to the buffer.
-            if( mmioinfoIn.pchNext == mmioinfoIn.pchEndRead )
-            {
-                if( 0 != mmioAdvance( m_hmmio, &mmioinfoIn, MMIO_READ ) )
-                         TRACE ("ERROR DIRECTSOUND MMIOADVANCE")
-                  	else /* TRACE ("DIRECTSOUND MMIOADVANCE OK")*/;
-
-
-                if( mmioinfoIn.pchNext == mmioinfoIn.pchEndRead )
-                     TRACE ("ERROR DIRECTSOUND READ FIC")
-	            else /* TRACE ("DIRECTSOUND READ FIC OK") */;
-            }
-
-            // Actual copy.
-            *((BYTE*)pDSLockedBuffer+cT) = *((BYTE*)mmioinfoIn.pchNext);
-            mmioinfoIn.pchNext++;
+        apDSBuffer[0]->Stop();
+        apDSBuffer[0]->Release();
     }
+    delete[] apDSBuffer;
+    apDSBuffer = NULL;
+}
 
-    if( 0 != mmioSetInfo( m_hmmio, &mmioinfoIn, 0 ) )
-           TRACE ("ERROR DIRECTSOUND MMIOSETINFO")
-	  else TRACE ("DIRECTSOUND MMIOSETINFO OK");
+int SoundEvent::PlaySound(char *filenames,int newbuffer, double offset)
+{
+    HRESULT hr;
 
-    mmioClose( m_hmmio, 0 );
+    TRACESETUP("PLAYSOUND");
 
-    dwWavDataRead = cbDataIn;
-    } // end of newbuffer part
+    pending = false;
 
+    if (newbuffer)
+    {
+        //
+        // Never wait for the disk here. If the clip isn't decoded yet, play()
+        // starts it later.
+        //
+        std::shared_ptr<SoundClip> clip = soundcache.Find(filenames);
+        if (!clip)
+        {
+            strncpy(pendingfile, filenames, sizeof(pendingfile) - 1);
+            pendingfile[sizeof(pendingfile) - 1] = 0;
+            pendingoffset = offset;
+            pending = true;
+            return(true);
+        }
 
-//  Unlock the buffer, we don't need it anymore.
-//  apDSBuffer[0]->Unlock( pDSLockedBuffer, dwDSLockedBufferSize, NULL, 0 );
+        if (!clip->valid)
+        {
+            TRACE ("DIRECT SOUND ERROR READING WAVE FILE");
+            return(false);
+        }
+
+        if (!CreateBuffer(*clip))
+            return(false);
+    }
 
+    if (apDSBuffer == NULL)
+        return(false);
 
     if (offset > 0.)
     {
@@ -1126,10 +1252,7 @@ TRACE ("APPEL CREATE SOUND BUFFER");
          TRACE(buffers);
 	}
 
-
-//    if (newbuffer)
-        apDSBuffer[0]->Play( 0, 0, 0L );
-
+    apDSBuffer[0]->Play( 0, 0, 0L );
 
     return(true);  
 }
@@ -1184,9 +1307,11 @@ int SoundEvent::Stop()
 
 int SoundEvent::Done()
 {
+	soundcache.Shutdown();
+
 	if (apDSBuffer == NULL)
 		return (false);
-    // Unlock the buffer, we don't need it anymore.
-    apDSBuffer[0]->Unlock( pDSLockedBuffer, dwDSLockedBufferSize, NULL, 0 );
+    // Release the buffer, we don't need it anymore.
+    ReleaseBuffer();
     return(true);
 }
@@ -37,6 +37,91 @@ typedef unsigned long *DWORD_PTR;
 
 #include "dsound.h"
 
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+
+#include "thread.h"
+
+///
+/// Size of the decoded sound cache in bytes.
+///
+#define SOUNDEVENT_CACHE_SIZE	(32 * 1024 * 1024)
+
+///
+/// Number of upcoming sound events which are decoded ahead of time.
+///
+#define SOUNDEVENT_PREFETCH		4
+
+///
+/// \brief Decoded wave file.
+/// \ingroup Sound
+///
+struct SoundClip {
+	std::string filename;
+	std::vector<BYTE> format;	///< WAVEFORMATEX including the extra format bytes.
+	std::vector<BYTE> data;		///< Sample data.
+	bool valid;					///< False if the file couldn't be read.
+};
+
+///
+/// \brief Background decoder and cache for the sound event wave files.
+///
+/// Files are decoded on a worker thread and kept in memory up to a total size, the least
+/// recently used clips are dropped first. The timestep only ever looks up finished clips,
+/// it never waits for the disk. The decoder is passed in, the cache itself doesn't know
+/// anything about the file format or DirectSound.
+///
+/// \ingroup Sound
+///
+class SoundClipCache {
+
+public:
+	typedef bool (*Decoder)(const char *filename, SoundClip &clip);
+
+	SoundClipCache(Decoder decoder, size_t maxbytes);
+	~SoundClipCache();
+
+	///
+	/// Queues a file for decoding, does nothing if it's already cached or queued.
+	///
+	void Prefetch(const char *filename);
+
+	///
+	/// Returns the decoded clip, or NULL if it isn't ready yet. A file which isn't
+	/// cached is queued for decoding.
+	///
+	std::shared_ptr<SoundClip> Find(const char *filename);
+
+	///
+	/// Stops the worker thread and empties the cache.
+	///
+	void Shutdown();
+
+protected:
+	void Insert(std::shared_ptr<SoundClip> clip);
+	void Run();
+	static DWORD WINAPI ThreadEntry(void *arg);
+
+	Decoder decoder;
+	size_t maxbytes;
+	size_t bytes;
+
+	std::list<std::shared_ptr<SoundClip> > clips;	///< Least recently used first.
+	std::list<std::string> queue;					///< Files to decode, the front one is in work.
+
+	Mutex mutex;
+	Event wakeup;
+	HANDLE hThread;
+	bool quit;
+
+private:
+	// The worker thread holds a pointer to the cache
+	SoundClipCache(const SoundClipCache &);
+	void operator=(const SoundClipCache &);
+};
+
 // MODIF x15  managing landing sound
 
 ///
@@ -70,6 +155,11 @@ public:
 	int	Finish(double offsetfinish);
 
 protected:
+	void PrefetchAhead();
+	bool CreateBuffer(const SoundClip &clip);
+	void ReleaseBuffer();
+
+	static bool EarlierMET(const SoundEvent &a, const SoundEvent &b);
 
 	double altitude  ;
 	int    mode      ;
@@ -81,6 +171,12 @@ protected:
 	double timeafterignition;
 	double timetoapproach;
 	int    mandatory ;
+
+	// Event started while its clip was still being decoded
+	bool   pending   ;
+	char   pendingfile[255] ;
+	double pendingoffset ;
+	int    prefetched ;
 	
 	SoundLib soundlib;
 	LPDIRECTSOUND8  m_pDS;
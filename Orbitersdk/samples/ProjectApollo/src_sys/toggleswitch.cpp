@@ -1419,6 +1419,35 @@ bool PanelSwitches::GetFlashing(const char *n) {
 	return false;
 }
 
+PanelSwitchItem *PanelSwitches::GetItem(const char *n)
+
+{
+	PanelSwitchItem *p;
+	SwitchRow *row = RowList;
+
+	while (row) {
+		p = row->GetItemByName(n);
+		if (p)
+		{
+			return p;
+		}
+
+		row = row->GetNext();
+	}
+
+	return NULL;
+}
+
+void PanelSwitches::SetItemState(PanelSwitchItem *p, int value, bool guard, bool hold)
+
+{
+	p->Unguard();
+	p->SetHeld(hold);
+	p->SetState(value);
+	if (guard)
+		p->Guard();
+}
+
 int PanelSwitches::GetState(const char *n)
 
 {
@@ -1460,20 +1489,11 @@ bool PanelSwitches::GetFailedState(const char *n)
 bool PanelSwitches::SetState(const char *n, int value, bool guard, bool hold)
 
 {
-	PanelSwitchItem *p;
-	SwitchRow *row = RowList;
+	PanelSwitchItem *p = GetItem(n);
 
-	while (row) {
-		p = row->GetItemByName(n);
-		if (p) {
-			p->Unguard();
-			p->SetHeld(hold);
-			p->SetState(value);
-			if (guard)
-				p->Guard();			
-			return true;
-		}
-		row = row->GetNext();
+	if (p) {
+		SetItemState(p, value, guard, hold);
+		return true;
 	}
 
 	/// \todo When false is returned, the checklist controller loops infinitely, better solution?
@@ -4562,6 +4582,14 @@ bool PanelConnector::ReceiveMessage(Connector *from, ConnectorMessage &m)
 		m.val1.bValue = panel.GetFailedState(static_cast<char *>(m.val1.pValue));
 		return true;
 
+	case MFD_PANEL_GET_ITEM:
+		m.val1.pValue = panel.GetItem(static_cast<char *>(m.val1.pValue));
+		return true;
+
+	case MFD_PANEL_GET_ITEM_VERSION:
+		m.val1.iValue = panel.GetVersion();
+		return true;
+
 	case MFD_PANEL_CHECKLIST_AUTOCOMPLETE:
 		m.val1.bValue = checklist.autoComplete(m.val1.bValue);
 		return true;
@@ -1387,11 +1387,11 @@ protected:
 class PanelSwitches {
 
 public:
-	PanelSwitches() { PanelID = 0; RowList = 0; lastexecutedtime=MINUS_INFINITY;};
+	PanelSwitches() { PanelID = 0; RowList = 0; Version = 0; lastexecutedtime=MINUS_INFINITY;};
 	bool CheckMouseClick(int id, int event, int mx, int my);
 	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn);
-	void AddRow(SwitchRow *s) { s->SetNext(RowList); RowList = s; };
-	void Init(int id, VESSEL *v, SoundLib *s, PanelSwitchListener *l) { PanelID = id; RowList = 0; vessel = v; soundlib = s; listener = l; };
+	void AddRow(SwitchRow *s) { s->SetNext(RowList); RowList = s; Version++; };
+	void Init(int id, VESSEL *v, SoundLib *s, PanelSwitchListener *l) { PanelID = id; RowList = 0; Version++; vessel = v; soundlib = s; listener = l; };
 	void timestep(double missionTime);
 
 	///
@@ -1408,12 +1408,32 @@ public:
 	bool GetFailedState(const char *n);
 	bool GetFlashing(const char *n);
 
+	///
+	/// Look up a panel item by its name.
+	///
+	/// \param n Item name.
+	/// \return Item if found, NULL if not.
+	///
+	PanelSwitchItem *GetItem(const char *n);
+
+	///
+	/// Set the state of an item like SetState does, without looking it up by name.
+	///
+	static void SetItemState(PanelSwitchItem *p, int value, bool guard = false, bool hold = false);
+
+	///
+	/// \brief Changes whenever the switch rows are set up again.
+	/// \return Version of the switch rows, items looked up with an older version have to be looked up again.
+	///
+	unsigned GetVersion() { return Version; };
+
 protected:
 	VESSEL *vessel;
 	SoundLib *soundlib;
 	PanelSwitchListener *listener;
 	int	PanelID;
 	SwitchRow *RowList;
+	unsigned Version;
 	double lastexecutedtime;
 
 	friend class ToggleSwitch;